@@ -0,0 +1,127 @@
+/*
+ * Atlas.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "Atlas.h"
+
+// constructor for an empty atlas (use Atlas::create later)
+Atlas::Atlas() : shelfX(0), shelfY(0), shelfHeight(0), colorKeyEnabled(false), colorKey(0) {}
+
+// constructor creating an empty atlas with the specified width (w) and height (h)
+Atlas::Atlas(int w, int h) : Atlas() {
+	this->create(w, h);
+}
+
+// destructor stub
+Atlas::~Atlas() {}
+
+// (re-)create an empty atlas with the specified width (w) and height (h)
+void Atlas::create(int w, int h) {
+	if(w <= 0 || h <= 0)
+		throw std::runtime_error("Atlas::create(): invalid size");
+
+	this->pixels.allocate(w, h, 4);
+	this->pixels.fill(0, 0, 0, 0);
+
+	this->clear();
+}
+
+// add a sprite with the specified width (w) and height (h), return its index
+//	NOTE:	The sprite data (rgba) needs to contain four bytes per pixel with rows from top to bottom,
+//			like they are stored in most image files. They will be stored bottom-up like in the window.
+std::size_t Atlas::add(int w, int h, const unsigned char * rgba) {
+	if(!(this->pixels))
+		throw std::runtime_error("Atlas::add(): atlas has not been created");
+
+	if(w <= 0 || h <= 0 || !rgba)
+		throw std::runtime_error("Atlas::add(): invalid sprite");
+
+	// start a new shelf if necessary
+	if(this->shelfX + w > this->pixels.getWidth()) {
+		this->shelfX = 0;
+		this->shelfY += this->shelfHeight;
+		this->shelfHeight = 0;
+	}
+
+	if(w > this->pixels.getWidth() || this->shelfY + h > this->pixels.getHeight())
+		throw std::runtime_error(
+				"Atlas::add(): no space left for sprite #"
+				+ std::to_string(this->sprites.size())
+				+ " ("
+				+ std::to_string(w)
+				+ "x"
+				+ std::to_string(h)
+				+ ")"
+		);
+
+	// copy the sprite row by row
+	auto * target = static_cast<unsigned char *>(this->pixels.get());
+	const std::size_t rowSize = static_cast<std::size_t>(w) * 4;
+
+	for(int row = 0; row < h; ++row)
+		std::memcpy(
+				target + (static_cast<std::size_t>(this->shelfY + h - 1 - row) * this->pixels.getWidth() + this->shelfX) * 4,
+				rgba + row * rowSize,
+				rowSize
+		);
+
+	this->sprites.emplace_back(this->shelfX, this->shelfY, w, h);
+
+	this->shelfX += w;
+
+	if(h > this->shelfHeight)
+		this->shelfHeight = h;
+
+	return this->sprites.size() - 1;
+}
+
+// remove all sprites (without clearing the pixels)
+void Atlas::clear() {
+	this->sprites.clear();
+
+	this->shelfX = 0;
+	this->shelfY = 0;
+	this->shelfHeight = 0;
+}
+
+// set the color key, i.e. the color (r, g, b) of transparent pixels
+void Atlas::setColorKey(unsigned char r, unsigned char g, unsigned char b) {
+	this->colorKey = Pixels::pack(r, g, b, 0);
+	this->colorKeyEnabled = true;
+}
+
+// disable the color key, i.e. draw all pixels
+void Atlas::disableColorKey() {
+	this->colorKeyEnabled = false;
+}
+
+// get the number of sprites in the atlas
+std::size_t Atlas::size() const {
+	return this->sprites.size();
+}
+
+// get the position and the size of the sprite with the specified index
+const Atlas::Sprite& Atlas::getSprite(std::size_t index) const {
+	if(index >= this->sprites.size())
+		throw std::runtime_error("Atlas::getSprite(): invalid sprite #" + std::to_string(index));
+
+	return this->sprites[index];
+}
+
+// get the pixels of the atlas
+const Pixels& Atlas::getPixels() const {
+	return this->pixels;
+}
+
+// get whether a color key has been set
+bool Atlas::hasColorKey() const {
+	return this->colorKeyEnabled;
+}
+
+// get the color key (see Pixels::pack)
+uint32_t Atlas::getColorKey() const {
+	return this->colorKey;
+}
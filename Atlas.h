@@ -0,0 +1,64 @@
+/*
+ * Atlas.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef ATLAS_H_
+#define ATLAS_H_
+
+#pragma once
+
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint32_t
+#include <cstring>		// std::memcpy
+#include <stdexcept>	// std::runtime_error
+#include <string>		// std::to_string
+#include <vector>		// std::vector
+
+#include "Pixels.h"
+
+// texture atlas packing multiple sprites into one pixel buffer (in rows, i.e. 'shelves')
+class Atlas {
+public:
+	struct Sprite {
+		int x;
+		int y;
+		int w;
+		int h;
+
+		Sprite() : x(0), y(0), w(0), h(0) {}
+		Sprite(int _x, int _y, int _w, int _h) : x(_x), y(_y), w(_w), h(_h) {}
+	};
+
+	Atlas();
+	Atlas(int w, int h);
+	virtual ~Atlas();
+
+	void create(int w, int h);
+	std::size_t add(int w, int h, const unsigned char * rgba);
+	void clear();
+
+	void setColorKey(unsigned char r, unsigned char g, unsigned char b);
+	void disableColorKey();
+
+	std::size_t size() const;
+	const Sprite& getSprite(std::size_t index) const;
+	const Pixels& getPixels() const;
+	bool hasColorKey() const;
+	uint32_t getColorKey() const;
+
+private:
+	Pixels pixels;
+	std::vector<Sprite> sprites;
+
+	int shelfX;
+	int shelfY;
+	int shelfHeight;
+
+	bool colorKeyEnabled;
+	uint32_t colorKey;
+};
+
+#endif /* ATLAS_H_ */
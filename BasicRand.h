@@ -0,0 +1,679 @@
+/*
+ * BasicRand.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef BASICRAND_H_
+#define BASICRAND_H_
+
+#pragma once
+
+#include <algorithm>	// std::min
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint32_t, uint64_t
+#include <cstdlib>		// std::rand, std::srand, RAND_MAX
+#include <cstring>		// std::memcpy
+#include <limits>		// std::numeric_limits
+#include <random>		// std::mt19937, std::random_device, std::seed_seq
+#include <stdexcept>	// std::runtime_error
+
+#ifdef __AVX2__
+#include <immintrin.h>	// AVX2 intrinsics
+#endif
+
+// generators of pseudo-random 32-bit numbers to be used by BasicRand
+//	NOTE:	Each generator needs to provide seed(uint32_t), operator() returning a number from 0 to max,
+//			fill(uint32_t *, std::size_t) writing the same numbers into a buffer, split(uint32_t) returning
+//			an independent generator for the specified stream, and the static members max and name.
+//			Splitting does not change the generator itself, but the new generator depends on its state,
+//			i.e. nested splits (e.g. g.split(0).split(0)) result in other streams than g.split(1).
+//			max needs to be a power of two minus one.
+namespace RandGenerator {
+	// count the bits of a power of two minus one (i.e. of the maximum of a generator)
+	constexpr unsigned int countBits(uint64_t max) {
+		return max ? 1 + countBits(max >> 1) : 0;
+	}
+
+	// std::rand (using the global state of the C library)
+	struct StdRand {
+		static constexpr uint32_t max = RAND_MAX;
+		static constexpr const char * name = "std::rand";
+
+		void seed(uint32_t s) {
+			std::srand(s);
+		}
+
+		uint32_t operator()() {
+			return static_cast<uint32_t>(std::rand());
+		}
+
+		void fill(uint32_t * out, std::size_t n) {
+			for(std::size_t i = 0; i < n; ++i)
+				out[i] = (*this)();
+		}
+
+		StdRand split(uint32_t) const {
+			throw std::runtime_error("RandGenerator::StdRand::split(): std::rand uses one state shared by all threads");
+		}
+	};
+
+	// std::mt19937 (Mersenne Twister)
+	struct MT19937 {
+		static constexpr uint32_t max = 0xFFFFFFFF;
+		static constexpr const char * name = "std::mt19937";
+
+		void seed(uint32_t s) {
+			this->mt.seed(s);
+		}
+
+		uint32_t operator()() {
+			return static_cast<uint32_t>(this->mt());
+		}
+
+		void fill(uint32_t * out, std::size_t n) {
+			for(std::size_t i = 0; i < n; ++i)
+				out[i] = (*this)();
+		}
+
+		// seed a new generator with numbers from (a copy of) the current state and the stream
+		MT19937 split(uint32_t stream) const {
+			std::mt19937 copy(this->mt);
+			uint32_t seeds[9];
+
+			for(std::size_t n = 0; n < 8; ++n)
+				seeds[n] = static_cast<uint32_t>(copy());
+
+			seeds[8] = stream;
+
+			std::seed_seq sequence(seeds, seeds + 9);
+			MT19937 result;
+
+			result.mt.seed(sequence);
+
+			return result;
+		}
+
+		std::mt19937 mt;
+	};
+
+	// 32-bit Lehmer generator
+	struct Lehmer32 {
+		static constexpr uint32_t max = 0xFFFFFFFF;
+		static constexpr const char * name = "lehmer32";
+
+		void seed(uint32_t s) {
+			this->state = s;
+		}
+
+		uint32_t operator()() {
+			this->state += 0xe120fc15;
+
+			return Lehmer32::hash(this->state);
+		}
+
+		void fill(uint32_t * out, std::size_t n) {
+			std::size_t i = 0;
+
+#ifdef __AVX2__
+			// generate eight numbers at once, each lane using the state it would have in the scalar generator
+			const __m256i step = _mm256_set1_epi32(static_cast<int>(0xe120fc15u * 8));
+			const __m256i factor1 = _mm256_set1_epi32(0x4a39b70d);
+			const __m256i factor2 = _mm256_set1_epi32(0x12fad5c9);
+
+			__m256i states = _mm256_add_epi32(
+					_mm256_set1_epi32(static_cast<int>(this->state)),
+					_mm256_mullo_epi32(_mm256_set1_epi32(static_cast<int>(0xe120fc15u)), _mm256_setr_epi32(1, 2, 3, 4, 5, 6, 7, 8))
+			);
+
+			for(; i + 8 <= n; i += 8) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), Lehmer32::mix(Lehmer32::mix(states, factor1), factor2));
+
+				states = _mm256_add_epi32(states, step);
+			}
+
+			this->state += static_cast<uint32_t>(i) * 0xe120fc15u;
+#endif
+
+			for(; i < n; ++i)
+				out[i] = (*this)();
+		}
+
+		// derive the state of a new generator from the current state and the stream
+		//	NOTE:	With only 32 bits of state, all streams are different positions in the same cycle of 2^32 numbers.
+		Lehmer32 split(uint32_t stream) const {
+			Lehmer32 result;
+
+			result.state = Lehmer32::hash(Lehmer32::hash(this->state) ^ Lehmer32::hash(stream * 0x9e3779b9u + 1));
+
+			return result;
+		}
+
+		// mix the bits of the specified number
+		static uint32_t hash(uint32_t value) {
+			uint64_t tmp = static_cast<uint64_t>(value) * 0x4a39b70d;
+			const uint32_t m1 = static_cast<uint32_t>((tmp >> 32) ^ tmp);
+
+			tmp = static_cast<uint64_t>(m1) * 0x12fad5c9;
+
+			return static_cast<uint32_t>((tmp >> 32) ^ tmp);
+		}
+
+#ifdef __AVX2__
+		// multiply eight numbers by a factor and fold the upper into the lower 32 bits of each 64-bit product
+		static __m256i mix(__m256i values, __m256i factor) {
+			const __m256i even = _mm256_mul_epu32(values, factor);
+			const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(values, 32), factor);
+
+			return _mm256_blend_epi32(
+					_mm256_xor_si256(even, _mm256_srli_epi64(even, 32)),
+					_mm256_xor_si256(odd, _mm256_slli_epi64(odd, 32)),
+					0xAA
+			);
+		}
+#endif
+
+		uint32_t state = 0;
+	};
+
+	// SplitMix64 (using the upper 32 bits of every 64-bit number)
+	struct SplitMix64 {
+		static constexpr uint32_t max = 0xFFFFFFFF;
+		static constexpr const char * name = "splitmix64";
+
+		void seed(uint32_t s) {
+			this->state = s;
+		}
+
+		uint32_t operator()() {
+			return static_cast<uint32_t>(this->next() >> 32);
+		}
+
+		void fill(uint32_t * out, std::size_t n) {
+			for(std::size_t i = 0; i < n; ++i)
+				out[i] = (*this)();
+		}
+
+		// derive the state of a new generator from the current state and the stream
+		SplitMix64 split(uint32_t stream) const {
+			SplitMix64 result;
+
+			result.state = SplitMix64::hash(this->state ^ SplitMix64::hash(stream + 0x9e3779b97f4a7c15));
+
+			return result;
+		}
+
+		uint64_t next() {
+			this->state += 0x9e3779b97f4a7c15;
+
+			return SplitMix64::hash(this->state);
+		}
+
+		// mix the bits of the specified number
+		static uint64_t hash(uint64_t value) {
+			value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+			value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+
+			return value ^ (value >> 31);
+		}
+
+		uint64_t state = 0;
+	};
+
+	// xoshiro256++ (using the upper 32 bits of every 64-bit number)
+	struct Xoshiro256PlusPlus {
+		static constexpr uint32_t max = 0xFFFFFFFF;
+		static constexpr const char * name = "xoshiro256++";
+
+		// seed the state using SplitMix64
+		void seed(uint32_t s) {
+			SplitMix64 seeder;
+
+			seeder.seed(s);
+
+			for(auto& word : this->state)
+				word = seeder.next();
+		}
+
+		uint32_t operator()() {
+			const uint64_t result = Xoshiro256PlusPlus::rotate(this->state[0] + this->state[3], 23) + this->state[0];
+			const uint64_t t = this->state[1] << 17;
+
+			this->state[2] ^= this->state[0];
+			this->state[3] ^= this->state[1];
+			this->state[1] ^= this->state[2];
+			this->state[0] ^= this->state[3];
+			this->state[2] ^= t;
+			this->state[3] = Xoshiro256PlusPlus::rotate(this->state[3], 45);
+
+			return static_cast<uint32_t>(result >> 32);
+		}
+
+		void fill(uint32_t * out, std::size_t n) {
+			for(std::size_t i = 0; i < n; ++i)
+				out[i] = (*this)();
+		}
+
+		// derive the state of a new generator from the current state and the stream (using SplitMix64)
+		//	NOTE:	Every stream starts at a pseudo-random position in the cycle of 2^256 - 1 numbers, i.e. overlapping is
+		//			very unlikely. Use jump for streams that are guaranteed not to overlap.
+		Xoshiro256PlusPlus split(uint32_t stream) const {
+			SplitMix64 seeder;
+
+			seeder.state = SplitMix64::hash(stream + 0x9e3779b97f4a7c15);
+
+			for(const auto word : this->state)
+				seeder.state = SplitMix64::hash(seeder.state ^ word);
+
+			Xoshiro256PlusPlus result;
+
+			for(auto& word : result.state)
+				word = seeder.next();
+
+			return result;
+		}
+
+		// advance the generator by 2^128 numbers (e.g. to get a non-overlapping stream from a copy before jumping)
+		//	NOTE:	Needs 256 steps of the generator.
+		void jump() {
+			constexpr uint64_t polynomial[] = {
+					0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c
+			};
+
+			uint64_t jumped[4] = {};
+
+			for(const auto word : polynomial)
+				for(unsigned int bit = 0; bit < 64; ++bit) {
+					if(word & (uint64_t{1} << bit))
+						for(std::size_t n = 0; n < 4; ++n)
+							jumped[n] ^= this->state[n];
+
+					(*this)();
+				}
+
+			std::memcpy(this->state, jumped, sizeof this->state);
+		}
+
+		static uint64_t rotate(uint64_t value, unsigned int bits) {
+			return (value << bits) | (value >> (64 - bits));
+		}
+
+		uint64_t state[4] = {};
+	};
+
+	// xoshiro128+
+	//	NOTE:	The lowest bits are of low quality, which does not matter when generating real numbers.
+	struct Xoshiro128Plus {
+		static constexpr uint32_t max = 0xFFFFFFFF;
+		static constexpr const char * name = "xoshiro128+";
+
+		// seed the state using SplitMix64
+		void seed(uint32_t s) {
+			SplitMix64 seeder;
+
+			seeder.seed(s);
+
+			for(auto& word : this->state)
+				word = static_cast<uint32_t>(seeder.next() >> 32);
+		}
+
+		uint32_t operator()() {
+			const uint32_t result = this->state[0] + this->state[3];
+			const uint32_t t = this->state[1] << 9;
+
+			this->state[2] ^= this->state[0];
+			this->state[3] ^= this->state[1];
+			this->state[1] ^= this->state[2];
+			this->state[0] ^= this->state[3];
+			this->state[2] ^= t;
+			this->state[3] = (this->state[3] << 11) | (this->state[3] >> 21);
+
+			return result;
+		}
+
+		void fill(uint32_t * out, std::size_t n) {
+			for(std::size_t i = 0; i < n; ++i)
+				out[i] = (*this)();
+		}
+
+		// derive the state of a new generator from the current state and the stream (using SplitMix64)
+		//	NOTE:	Every stream starts at a pseudo-random position in the cycle of 2^128 - 1 numbers, i.e. overlapping is
+		//			unlikely. Use jump for streams that are guaranteed not to overlap.
+		Xoshiro128Plus split(uint32_t stream) const {
+			SplitMix64 seeder;
+
+			seeder.state = SplitMix64::hash(stream + 0x9e3779b97f4a7c15);
+
+			for(const auto word : this->state)
+				seeder.state = SplitMix64::hash(seeder.state ^ word);
+
+			Xoshiro128Plus result;
+
+			for(auto& word : result.state)
+				word = static_cast<uint32_t>(seeder.next() >> 32);
+
+			// the state must not be zero
+			if(!(result.state[0] | result.state[1] | result.state[2] | result.state[3]))
+				result.state[0] = 1;
+
+			return result;
+		}
+
+		// advance the generator by 2^64 numbers (e.g. to get a non-overlapping stream from a copy before jumping)
+		//	NOTE:	Needs 128 steps of the generator.
+		void jump() {
+			constexpr uint32_t polynomial[] = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+
+			uint32_t jumped[4] = {};
+
+			for(const auto word : polynomial)
+				for(unsigned int bit = 0; bit < 32; ++bit) {
+					if(word & (uint32_t{1} << bit))
+						for(std::size_t n = 0; n < 4; ++n)
+							jumped[n] ^= this->state[n];
+
+					(*this)();
+				}
+
+			std::memcpy(this->state, jumped, sizeof this->state);
+		}
+
+		uint32_t state[4] = {};
+	};
+
+	// PCG32 (XSH RR variant of the permuted congruential generator)
+	struct PCG32 {
+		static constexpr uint32_t max = 0xFFFFFFFF;
+		static constexpr const char * name = "pcg32";
+
+		// seed the generator using its default stream
+		void seed(uint32_t s) {
+			this->seed(s, PCG32::defaultStream);
+		}
+
+		// seed the generator using the specified stream
+		void seed(uint64_t s, uint64_t stream) {
+			this->state = 0;
+			this->increment = (stream << 1) | 1;
+
+			(*this)();
+
+			this->state += s;
+
+			(*this)();
+		}
+
+		uint32_t operator()() {
+			const uint64_t old = this->state;
+
+			this->state = old * 0x5851f42d4c957f2d + this->increment;
+
+			const uint32_t shifted = static_cast<uint32_t>(((old >> 18) ^ old) >> 27);
+			const unsigned int rotation = static_cast<unsigned int>(old >> 59);
+
+			return (shifted >> rotation) | (shifted << ((32 - rotation) & 31));
+		}
+
+		void fill(uint32_t * out, std::size_t n) {
+			for(std::size_t i = 0; i < n; ++i)
+				out[i] = (*this)();
+		}
+
+		// use a stream (i.e. increment) derived from the current one and the specified stream, starting from the current state
+		PCG32 split(uint32_t stream) const {
+			PCG32 result;
+
+			result.seed(this->state, SplitMix64::hash((this->increment >> 1) ^ SplitMix64::hash(stream + 0x9e3779b97f4a7c15)));
+
+			return result;
+		}
+
+		static constexpr uint64_t defaultStream = 0xda3e39cb94b95bdb >> 1;
+
+		uint64_t state = 0;
+		uint64_t increment = 1;
+	};
+
+	// wyrand (using the upper 32 bits of every 64-bit number)
+	struct Wyrand {
+		static constexpr uint32_t max = 0xFFFFFFFF;
+		static constexpr const char * name = "wyrand";
+
+		void seed(uint32_t s) {
+			this->state = s;
+		}
+
+		uint32_t operator()() {
+			this->state += 0xa0761d6478bd642f;
+
+			return static_cast<uint32_t>(Wyrand::multiply(this->state, this->state ^ 0xe7037ed1a0b428db) >> 32);
+		}
+
+		void fill(uint32_t * out, std::size_t n) {
+			for(std::size_t i = 0; i < n; ++i)
+				out[i] = (*this)();
+		}
+
+		// derive the state of a new generator from the current state and the stream
+		//	NOTE:	All streams are different positions in the same cycle of 2^64 numbers.
+		Wyrand split(uint32_t stream) const {
+			Wyrand result;
+
+			result.state = SplitMix64::hash(this->state ^ SplitMix64::hash(stream + 0x9e3779b97f4a7c15));
+
+			return result;
+		}
+
+		// multiply two numbers and fold the upper into the lower 64 bits of the 128-bit product
+		static uint64_t multiply(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+			const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+
+			return static_cast<uint64_t>(product >> 64) ^ static_cast<uint64_t>(product);
+#else
+			const uint64_t aLow = a & 0xFFFFFFFF;
+			const uint64_t aHigh = a >> 32;
+			const uint64_t bLow = b & 0xFFFFFFFF;
+			const uint64_t bHigh = b >> 32;
+			const uint64_t lowLow = aLow * bLow;
+			const uint64_t highLow = aHigh * bLow;
+			const uint64_t lowHigh = aLow * bHigh;
+			const uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + (lowHigh & 0xFFFFFFFF);
+			const uint64_t high = aHigh * bHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+
+			return high ^ ((middle << 32) | (lowLow & 0xFFFFFFFF));
+#endif
+		}
+
+		uint64_t state = 0;
+	};
+}
+
+// pseudo-random number generation with the algorithm chosen at compile time (see RandGenerator)
+//	NOTE:	Every call will be inlined into a few instructions, use Rand to choose the algorithm at runtime instead.
+template<typename Generator>
+class BasicRand {
+	static_assert(
+			(static_cast<uint64_t>(Generator::max) & (static_cast<uint64_t>(Generator::max) + 1)) == 0,
+			"The maximum of the generator needs to be a power of two minus one"
+	);
+
+public:
+	// constructor seeding the generator randomly
+	BasicRand()
+			: byteMin(0),
+			  byteMax(std::numeric_limits<unsigned char>::max()),
+			  intMin(0),
+			  intMax(std::numeric_limits<int>::max()),
+			  realMin(0.),
+			  realMax(1.) {
+		this->seed(std::random_device()());
+	}
+
+	// destructor stub
+	virtual ~BasicRand() {}
+
+	// set the seed of the generator
+	void seed(unsigned int s) {
+		this->generator.seed(s);
+	}
+
+	// get an independent generator for the specified stream (e.g. the index of a worker thread) with the same limits
+	//	NOTE:	The new generator only depends on the current state and the stream,
+	//			i.e. generators split from the same seed will always generate the same numbers.
+	//			Splitting it again (e.g. per worker, then per voice) results in streams different from all
+	//			streams split from this generator.
+	//			Throws for std::rand, which uses one state shared by all threads.
+	BasicRand split(unsigned int stream) const {
+		BasicRand result(*this);
+
+		result.generator = this->generator.split(stream);
+
+		return result;
+	}
+
+	// get the name of the algorithm
+	static const char * str() {
+		return Generator::name;
+	}
+
+	// set the limits for pseudo-random byte creation (default: 0 to std::numeric_limits<unsigned char>::max())
+	void setByteLimits(unsigned char from, unsigned char to) {
+		this->byteMin = from > to ? to : from;
+		this->byteMax = from > to ? from : to;
+	}
+
+	// set the limits for pseudo-random integer creation (default: 0 to std::numeric_limits<int>::max())
+	void setIntLimits(int from, int to) {
+		this->intMin = from > to ? to : from;
+		this->intMax = from > to ? from : to;
+	}
+
+	// set the limits for pseudo-random float creation (default: 0 to 1)
+	void setRealLimits(double from, double to) {
+		this->realMin = from > to ? to : from;
+		this->realMax = from > to ? from : to;
+	}
+
+	// generate a pseudo-random byte
+	unsigned char generateByte() {
+		return static_cast<unsigned char>(this->byteMin + this->bounded(this->generator(), this->byteMax + 1u - this->byteMin));
+	}
+
+	// generate a pseudo-random integer
+	int generateInt() {
+		return static_cast<int>(this->intMin + static_cast<int64_t>(this->bounded(this->generator(), this->getIntRange())));
+	}
+
+	// generate a pseudo-random real number
+	double generateReal() {
+		return this->realMin + static_cast<double>(this->generator()) / Generator::max * (this->realMax - this->realMin);
+	}
+
+	// generate a pseudo-random boolean value
+	bool generateBool() {
+		return this->generator() > Generator::max / 2;
+	}
+
+	// fill the specified buffer with pseudo-random bytes
+	//	NOTE:	The numbers will be generated in blocks (using SIMD instructions if the generator supports them),
+	//			i.e. they will differ from the numbers of generateByte.
+	void generateBytes(unsigned char * out, std::size_t n) {
+		const uint64_t range = this->byteMax + 1u - this->byteMin;
+
+		this->generateBulk(out, n, [this, range](uint32_t value) {
+			return static_cast<unsigned char>(this->byteMin + this->bounded(value, range));
+		});
+	}
+
+	// fill the specified buffer with pseudo-random integers (see generateBytes)
+	void generateInts(int * out, std::size_t n) {
+		const uint64_t range = this->getIntRange();
+
+		this->generateBulk(out, n, [this, range](uint32_t value) {
+			return static_cast<int>(this->intMin + static_cast<int64_t>(this->bounded(value, range)));
+		});
+	}
+
+	// fill the specified buffer with pseudo-random real numbers from the lower limit to (excluding) the upper limit
+	//	NOTE:	The random bits will be written into the mantissa of a number from 1 to 2 (excluding),
+	//			which avoids converting integers into floating point numbers (see generateBytes).
+	void generateReals(double * out, std::size_t n) {
+		const double min = this->realMin;
+		const double factor = this->realMax - this->realMin;
+
+		this->generateBulk(out, n, [min, factor](uint32_t value) {
+			const uint64_t bits = 0x3FF0000000000000 | (static_cast<uint64_t>(value) << (52 - BasicRand::bits));
+			double one = 0.;
+
+			std::memcpy(&one, &bits, sizeof one);
+
+			return min + (one - 1.) * factor;
+		});
+	}
+
+	// get the underlying generator
+	Generator& getGenerator() {
+		return this->generator;
+	}
+
+private:
+	static constexpr std::size_t bulkSize = 256;
+
+	// number of random bits per number generated by the generator
+	static constexpr unsigned int bits = RandGenerator::countBits(Generator::max);
+
+	// get the number of possible integers
+	uint64_t getIntRange() const {
+		return static_cast<uint64_t>(static_cast<int64_t>(this->intMax) - this->intMin) + 1;
+	}
+
+	// map the specified random number to a number from zero to (excluding) the specified range without bias,
+	//	generating more numbers if necessary, using Lemire's nearly divisionless method
+	//	NOTE:	The division is only needed in the rare case that the number might have to be rejected.
+	uint64_t bounded(uint32_t value, uint64_t range) {
+		constexpr uint64_t numbers = static_cast<uint64_t>(Generator::max) + 1;
+
+		if(range > numbers) {
+			// combine two numbers if the generator has not enough bits (e.g. std::rand), with a negligible bias
+			return ((static_cast<uint64_t>(value) << BasicRand::bits) | this->generator()) % range;
+		}
+
+		uint64_t product = value * range;
+
+		if((product & Generator::max) < range) {
+			const uint64_t threshold = (numbers - range) % range;
+
+			while((product & Generator::max) < threshold)
+				product = this->generator() * range;
+		}
+
+		return product >> BasicRand::bits;
+	}
+
+	// fill the specified buffer by generating numbers in blocks and mapping them using the specified function
+	template<typename T, typename Map> void generateBulk(T * out, std::size_t n, Map map) {
+		uint32_t buffer[BasicRand::bulkSize];
+
+		for(std::size_t done = 0; done < n; done += BasicRand::bulkSize) {
+			const std::size_t count = std::min(n - done, BasicRand::bulkSize);
+
+			this->generator.fill(buffer, count);
+
+			for(std::size_t i = 0; i < count; ++i)
+				out[done + i] = map(buffer[i]);
+		}
+	}
+
+	Generator generator;
+
+	unsigned char byteMin;
+	unsigned char byteMax;
+	int intMin;
+	int intMax;
+	double realMin;
+	double realMax;
+};
+
+#endif /* BASICRAND_H_ */
@@ -0,0 +1,404 @@
+/*
+ * Benchmark.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#include "Benchmark.h"
+
+// constructor
+Benchmark::Benchmark() : fileName("benchmark.json"), sink(0.), frame(0) {}
+
+// destructor
+Benchmark::~Benchmark() {}
+
+// run all benchmarks and write their results into the file specified as first argument (default: benchmark.json)
+int Benchmark::run(int argc, char * argv[]) {
+	if(argc > 1)
+		this->fileName = argv[1];
+
+	// run the benchmarks that do not need a window
+	this->benchmarkPixels();
+	this->benchmarkRand();
+	this->benchmarkMath();
+	this->benchmarkGeometry();
+	this->benchmarkSoundWave();
+	this->benchmarkConcurrentCircular();
+
+	// run the benchmarks that need a window
+	constexpr int width = 400;
+	constexpr int height = 300;
+
+	try {
+		this->createMainWindow(width, height, "benchmark");
+	}
+	catch(const std::runtime_error& e) {
+		std::cerr << "Skipping drawing into the window: " << e.what() << std::endl;
+
+		this->write();
+
+		return EXIT_SUCCESS;
+	}
+
+	this->setRenderingMode(MainWindow::RENDERING_MODE_PBO);
+
+	this->Engine::run();
+
+	this->write();
+
+	return EXIT_SUCCESS;
+}
+
+// create resources
+void Benchmark::onCreate() {}
+
+// draw into the window in every rendering mode, one repetition per frame
+void Benchmark::onUpdate(double elapsedTime) {
+	UNUSED(elapsedTime);
+
+	const int w = this->getWindowWidth();
+	const int h = this->getWindowHeight();
+	const std::size_t pixels = static_cast<std::size_t>(w) * h;
+
+	if(!pixels)
+		return;
+
+	// draw every pixel separately
+	auto begin = std::chrono::steady_clock::now();
+
+	for(int y = 0; y < h; ++y)
+		for(int x = 0; x < w; ++x)
+			this->draw(x, y, x & 0xff, y & 0xff, 0);
+
+	auto end = std::chrono::steady_clock::now();
+
+	if(this->frame >= Benchmark::warmUp)
+		this->putPixelSamples.push_back(std::chrono::duration<double, std::nano>(end - begin).count() / pixels);
+
+	// fill the whole window
+	begin = std::chrono::steady_clock::now();
+
+	this->fill(0, 0, w, h, 0, 0, 255);
+
+	end = std::chrono::steady_clock::now();
+
+	if(this->frame >= Benchmark::warmUp)
+		this->fillSamples.push_back(std::chrono::duration<double, std::nano>(end - begin).count() / pixels);
+
+	++(this->frame);
+
+	if(this->frame < Benchmark::warmUp + Benchmark::repetitions)
+		return;
+
+	// add the results for the current rendering mode and continue with the next one
+	const auto mode = this->getRenderingMode();
+	std::string modeName;
+
+	switch(mode) {
+	case MainWindow::RENDERING_MODE_PBO:
+		modeName = "pbo";
+
+		break;
+
+	case MainWindow::RENDERING_MODE_POINTS:
+		modeName = "points";
+
+		break;
+
+	case MainWindow::RENDERING_MODE_TEXTURE:
+		modeName = "texture";
+
+		break;
+	}
+
+	this->add("MainWindow::putPixel (" + modeName + ")", pixels, this->putPixelSamples);
+	this->add("Engine::fill (" + modeName + ")", pixels, this->fillSamples);
+
+	this->putPixelSamples.clear();
+	this->fillSamples.clear();
+
+	this->frame = 0;
+
+	switch(mode) {
+	case MainWindow::RENDERING_MODE_PBO:
+		this->setRenderingMode(MainWindow::RENDERING_MODE_POINTS);
+
+		break;
+
+	case MainWindow::RENDERING_MODE_POINTS:
+		this->setRenderingMode(MainWindow::RENDERING_MODE_TEXTURE);
+
+		break;
+
+	case MainWindow::RENDERING_MODE_TEXTURE:
+		this->close();
+
+		break;
+	}
+}
+
+// add the result of a benchmark from the specified samples (in nanoseconds per iteration) and print it
+void Benchmark::add(const std::string& name, std::size_t iterations, const std::vector<double>& samples) {
+	if(samples.empty())
+		throw std::runtime_error("Benchmark::add(): no samples for '" + name + "'");
+
+	Result result;
+
+	result.name = name;
+	result.iterations = iterations;
+	result.median = Benchmark::median(samples);
+
+	std::vector<double> deviations;
+
+	deviations.reserve(samples.size());
+
+	for(const auto sample : samples)
+		deviations.push_back(std::fabs(sample - result.median));
+
+	result.mad = Benchmark::median(deviations);
+
+	std::cout
+			<< std::left << std::setw(56) << result.name
+			<< std::right << std::setw(14) << std::fixed << std::setprecision(3) << result.median << " ns"
+			<< " +/- " << result.mad << " ns" << std::endl;
+
+	this->results.emplace_back(result);
+}
+
+// benchmark filling the whole buffer and setting single pixels
+void Benchmark::benchmarkPixels() {
+	constexpr int width = 1920;
+	constexpr int height = 1080;
+
+	Pixels pixels;
+
+	pixels.allocate(width, height, 4);
+
+	this->measure("Pixels::fill (1920x1080)", 1, [&pixels](std::size_t) {
+		pixels.fill(0, 128, 255, 255);
+	});
+
+	this->measure("Pixels::set", width * height, [&pixels](std::size_t i) {
+		pixels.set(i % width, i / width, i & 0xff, 0, 0, 255);
+	});
+}
+
+// benchmark generating pseudo-random numbers with every algorithm
+void Benchmark::benchmarkRand() {
+	constexpr std::size_t iterations = 1000000;
+
+	for(unsigned char n = 0; n < RAND_ALGO_NUM; ++n) {
+		Rand generator(static_cast<Rand::Algo>(n));
+
+		generator.setIntLimits(-1000, 1000);
+		generator.setRealLimits(-1., 1.);
+
+		const std::string algo(generator.str());
+
+		this->measure("Rand::generateByte (" + algo + ")", iterations, [this, &generator](std::size_t) {
+			this->sink = this->sink + generator.generateByte();
+		});
+
+		this->measure("Rand::generateInt (" + algo + ")", iterations, [this, &generator](std::size_t) {
+			this->sink = this->sink + generator.generateInt();
+		});
+
+		this->measure("Rand::generateReal (" + algo + ")", iterations, [this, &generator](std::size_t) {
+			this->sink = this->sink + generator.generateReal();
+		});
+
+		// without switching on the algorithm for every number
+		generator.visit([this, &algo](auto& rand) {
+			this->measure("BasicRand::generateByte (" + algo + ")", iterations, [this, &rand](std::size_t) {
+				this->sink = this->sink + rand.generateByte();
+			});
+		});
+
+		// in bulk, consuming every number
+		constexpr std::size_t bulk = 4096;
+
+		std::vector<unsigned char> bytes(bulk);
+		std::vector<double> reals(bulk);
+
+		this->measure("Rand::generateBytes (" + algo + ")", iterations, [this, &generator, &bytes](std::size_t i) {
+			if(i % bulk == 0)
+				generator.generateBytes(bytes.data(), bulk);
+
+			this->sink = this->sink + bytes[i % bulk];
+		});
+
+		this->measure("Rand::generateReals (" + algo + ")", iterations, [this, &generator, &reals](std::size_t i) {
+			if(i % bulk == 0)
+				generator.generateReals(reals.data(), bulk);
+
+			this->sink = this->sink + reals[i % bulk];
+		});
+	}
+}
+
+// benchmark the approximations of sine (and std::sin for comparison)
+void Benchmark::benchmarkMath() {
+	constexpr std::size_t iterations = 1000000;
+	constexpr double step = 0.0001;
+
+	this->measure("std::sin", iterations, [this](std::size_t i) {
+		this->sink = this->sink + std::sin(step * (i + 1));
+	});
+
+	this->measure("Math::approxSinTaylor", iterations, [this](std::size_t i) {
+		this->sink = this->sink + Math::approxSinTaylor(step * (i + 1));
+	});
+
+	this->measure("Math::approxSinQuad", iterations, [this](std::size_t i) {
+		this->sink = this->sink + Math::approxSinQuad(step * (i + 1));
+	});
+
+	this->measure("Math::approxSinCubic", iterations, [this](std::size_t i) {
+		this->sink = this->sink + Math::approxSinCubic(step * (i + 1));
+	});
+}
+
+// benchmark adding an increasing number of (overlapping) rectangles, one iteration being the addition of all of them
+void Benchmark::benchmarkGeometry() {
+	using Rect = Geometry::Rectangle<int, uint32_t>;
+
+	constexpr int size = 1000;
+	constexpr int maxRectSize = 200;
+
+	Rand generator(Rand::RAND_ALGO_LEHMER32);
+
+	generator.seed(1);
+	generator.setIntLimits(0, size - maxRectSize);
+
+	for(std::size_t count = 16; count <= 1024; count *= 4) {
+		std::vector<Rect> toAdd;
+
+		for(std::size_t n = 0; n < count; ++n) {
+			const int x = generator.generateInt();
+			const int y = generator.generateInt();
+
+			toAdd.emplace_back(x, y, x + 1 + generator.generateInt() % maxRectSize, y + 1 + generator.generateInt() % maxRectSize, n);
+		}
+
+		std::vector<Rect> rects;
+
+		this->measure("Geometry::addAndSplit (" + std::to_string(count) + " rects)", 1, [this, &toAdd, &rects](std::size_t) {
+			rects.clear();
+
+			for(const auto& rect : toAdd)
+				Geometry::addAndSplit(rects, rect);
+
+			this->sink = this->sink + rects.size();
+		});
+	}
+}
+
+// benchmark getting samples of every type of sound wave
+void Benchmark::benchmarkSoundWave() {
+	constexpr std::size_t iterations = 100000;
+	constexpr double samplesPerSecond = 44100.;
+	constexpr std::size_t noiseSamples = 4096;
+	constexpr double length = 1000000.;
+
+	const SoundEnvelope envelope(SoundEnvelope::ADRTimes(0.01, 0.01, 0.1), 1., 0.8);
+
+	Rand noiseGenerator(Rand::RAND_ALGO_LEHMER32);
+
+	noiseGenerator.setRealLimits(-1., 1.);
+
+	SoundWave::Noise noise;
+
+	for(std::size_t n = 0; n < noiseSamples; ++n)
+		noise.push_back(noiseGenerator.generateReal());
+
+	for(
+			unsigned int type = SoundWave::SOUNDWAVE_SINE;
+			type <= SoundWave::SOUNDWAVE_NOISE_HASHED;
+			++type
+	) {
+		SoundWave wave(
+				SoundWave::Properties(static_cast<SoundWave::Type>(type), 440., length, 0.),
+				envelope,
+				&noiseGenerator,
+				&noise,
+				samplesPerSecond
+		);
+
+		wave.start(0.);
+
+		this->measure("SoundWave::get (" + wave.getTypeString() + ")", iterations, [this, &wave](std::size_t i) {
+			this->sink = this->sink + wave.get(1. + i / samplesPerSecond);
+		});
+	}
+}
+
+// benchmark pushing an element into and popping it from the circular buffer (from the same thread)
+void Benchmark::benchmarkConcurrentCircular() {
+	constexpr std::size_t iterations = 1000000;
+
+	ConcurrentCircular<int> buffer(64);
+
+	this->measure("ConcurrentCircular::push/pop", iterations, [this, &buffer](std::size_t i) {
+		int in = static_cast<int>(i);
+		int out = 0;
+
+		buffer.push(in);
+		buffer.pop(out);
+
+		this->sink = this->sink + out;
+	});
+}
+
+// write the results into the JSON file
+void Benchmark::write() const {
+	std::ofstream out(this->fileName);
+
+	if(!out)
+		throw std::runtime_error("Benchmark::write(): could not open '" + this->fileName + "'");
+
+	out.precision(6);
+
+	out << "{\n";
+	out << "\t\"compiler\": \"" << __VERSION__ << "\",\n";
+	out << "\t\"warmup\": " << Benchmark::warmUp << ",\n";
+	out << "\t\"repetitions\": " << Benchmark::repetitions << ",\n";
+	out << "\t\"benchmarks\": [\n";
+
+	for(std::size_t n = 0; n < this->results.size(); ++n) {
+		const auto& result = this->results[n];
+
+		out << "\t\t{";
+		out << "\"name\": \"" << result.name << "\", ";
+		out << "\"iterations\": " << result.iterations << ", ";
+		out << std::fixed << "\"median_ns\": " << result.median << ", ";
+		out << "\"mad_ns\": " << result.mad;
+		out << "}";
+
+		if(n + 1 < this->results.size())
+			out << ",";
+
+		out << "\n";
+	}
+
+	out << "\t]\n";
+	out << "}\n";
+
+	std::cout << "Results written to " << this->fileName << std::endl;
+}
+
+// get the median of the specified values
+double Benchmark::median(std::vector<double> values) {
+	const std::size_t middle = values.size() / 2;
+
+	std::nth_element(values.begin(), values.begin() + middle, values.end());
+
+	if(values.size() % 2)
+		return values[middle];
+
+	const double upper = values[middle];
+
+	std::nth_element(values.begin(), values.begin() + middle - 1, values.begin() + middle);
+
+	return (values[middle - 1] + upper) / 2;
+}
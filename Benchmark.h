@@ -0,0 +1,106 @@
+/*
+ * Benchmark.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#pragma once
+
+#include "ConcurrentCircular.h"
+#include "Engine.h"
+#include "Geometry.h"
+#include "Math.h"
+#include "Pixels.h"
+#include "Rand.h"
+#include "SoundEnvelope.h"
+#include "SoundWave.h"
+
+#include <algorithm>	// std::nth_element
+#include <chrono>		// std::chrono
+#include <cmath>		// std::fabs, std::sin
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint32_t
+#include <cstdlib>		// EXIT_FAILURE, EXIT_SUCCESS
+#include <fstream>		// std::ofstream
+#include <iomanip>		// std::setw
+#include <iostream>		// std::cerr, std::cout, std::endl
+#include <stdexcept>	// std::runtime_error
+#include <string>		// std::string, std::to_string
+#include <vector>		// std::vector
+
+#define UNUSED(x) (void)(x)
+
+// benchmarks of the hot primitives, written into a JSON file to compare different builds
+//	NOTE:	Each benchmark is repeated after warming up, and the median and the median absolute deviation (MAD)
+//			of the time per iteration (in nanoseconds) are reported.
+//			Drawing into the window needs an OpenGL context, i.e. it will be skipped if no window can be created.
+class Benchmark : Engine {
+public:
+	static constexpr unsigned int warmUp = 3;
+	static constexpr unsigned int repetitions = 15;
+
+	Benchmark();
+	virtual ~Benchmark();
+
+	int run(int argc, char * argv[]);
+
+private:
+	struct Result {
+		std::string name;
+		std::size_t iterations;
+		double median;
+		double mad;
+	};
+
+	void onCreate() override;
+	void onUpdate(double elapsedTime) override;
+
+	template<typename Function> void measure(const std::string& name, std::size_t iterations, Function function);
+	void add(const std::string& name, std::size_t iterations, const std::vector<double>& samples);
+
+	void benchmarkPixels();
+	void benchmarkRand();
+	void benchmarkMath();
+	void benchmarkGeometry();
+	void benchmarkSoundWave();
+	void benchmarkConcurrentCircular();
+
+	void write() const;
+
+	static double median(std::vector<double> values);
+
+	std::string fileName;
+	std::vector<Result> results;
+	volatile double sink;
+
+	unsigned int frame;
+	std::vector<double> putPixelSamples;
+	std::vector<double> fillSamples;
+};
+
+// run the specified function for the specified number of iterations per repetition (after warming up) and add the result
+template<typename Function> void Benchmark::measure(const std::string& name, std::size_t iterations, Function function) {
+	std::vector<double> samples;
+
+	samples.reserve(Benchmark::repetitions);
+
+	for(unsigned int n = 0; n < Benchmark::warmUp + Benchmark::repetitions; ++n) {
+		const auto begin = std::chrono::steady_clock::now();
+
+		for(std::size_t i = 0; i < iterations; ++i)
+			function(i);
+
+		const auto end = std::chrono::steady_clock::now();
+
+		if(n >= Benchmark::warmUp)
+			samples.push_back(std::chrono::duration<double, std::nano>(end - begin).count() / iterations);
+	}
+
+	this->add(name, iterations, samples);
+}
+
+#endif /* BENCHMARK_H_ */
@@ -8,7 +8,13 @@
 #include "Engine.h"
 
 // constructor and destructor stubs
-Engine::Engine() : oldTime(0.), debugChanged(false) {}
+Engine::Engine()
+		: oldTime(0.),
+		  debugChanged(false),
+		  fixedTimestep(0.),
+		  maxTicks(0),
+		  accumulator(0.),
+		  droppedTicks(0) {}
 Engine::~Engine() {}
 
 // set the rendering mode
@@ -21,6 +27,11 @@ void Engine::setClearBuffer(bool clear) {
 	this->window.setClearBuffer(clear);
 }
 
+// set whether and how to use huge pages for the pixel buffer
+void Engine::setHugePages(Memory::HugePages hugePages) {
+	this->window.setHugePages(hugePages);
+}
+
 // set the actual size of one pixel
 void Engine::setPixelSize(unsigned short size) {
 	this->window.setPixelSize(size);
@@ -36,6 +47,51 @@ void Engine::disablePixelTest() {
 	this->window.setPixelTest(PixelTest());
 }
 
+// set whether to render only half of the pixels every frame (see Engine::shade) and how to reconstruct the other half
+void Engine::setInterlacing(MainWindow::Interlacing interlacing, MainWindow::Reconstruction reconstruction) {
+	this->window.setInterlacing(interlacing, reconstruction);
+}
+
+// set the filters to be applied after every frame (nullptr to disable post-processing)
+void Engine::setPostProcess(PostProcess * postProcess) {
+	this->window.setPostProcess(postProcess);
+}
+
+// add a layer on top of all other layers to be composited every frame
+void Engine::addLayer(Layer * layer) {
+	this->window.addLayer(layer);
+}
+
+// remove a layer from the layers to be composited every frame
+void Engine::removeLayer(Layer * layer) {
+	this->window.removeLayer(layer);
+}
+
+// set the recorder to write every finished frame into (nullptr to stop recording)
+void Engine::setRecorder(Recorder * recorder) {
+	this->window.setRecorder(recorder);
+}
+
+// set the replayer to show the frames of a recording instead of calling onUpdate (nullptr to stop replaying)
+void Engine::setReplayer(Replayer * replayer) {
+	this->window.setReplayer(replayer);
+}
+
+// set the ring in shared memory to export every finished frame into (nullptr to stop exporting)
+void Engine::setSharedFrames(SharedFrames * sharedFrames) {
+	this->window.setSharedFrames(sharedFrames);
+}
+
+// add the metrics of the window (i.e. frame times and uploaded bytes) to the registry (nullptr to stop)
+void Engine::setMetrics(Metrics * metrics) {
+	this->window.setMetrics(metrics);
+}
+
+// set the number of previous frames to keep (0 to keep none)
+void Engine::setHistory(unsigned int frames) {
+	this->window.setHistory(frames);
+}
+
 // set additional debugging information to be shown in the window title
 void Engine::setDebugText(const std::string& string) {
 	if(string != this->debug) {
@@ -44,6 +100,24 @@ void Engine::setDebugText(const std::string& string) {
 	}
 }
 
+// run the simulation at a fixed rate (0 to disable), calling onFixedUpdate for every tick and onRender once per frame
+//	NOTE:	With a fixed timestep, onFixedUpdate will be called zero or more times per frame with the fixed timestep (in seconds),
+//			followed by onRender with the share of the next tick that has already elapsed (from 0 to 1), which can be used
+//			to interpolate between the last two states of the simulation. onUpdate will be called before that as usual.
+//			At most the specified number of ticks will be run per frame, dropping any remaining ticks to catch up with
+//			(see Engine::getDroppedTicks), so that slow ticks cannot cause more and more ticks to be run every frame.
+void Engine::setFixedTimestep(double ticksPerSecond, unsigned int maxTicksPerFrame) {
+	if(ticksPerSecond < 0.)
+		throw std::runtime_error("Engine::setFixedTimestep(): invalid number of ticks per second");
+
+	if(ticksPerSecond > 0. && !maxTicksPerFrame)
+		throw std::runtime_error("Engine::setFixedTimestep(): at least one tick per frame is needed");
+
+	this->fixedTimestep = ticksPerSecond > 0. ? 1. / ticksPerSecond : 0.;
+	this->maxTicks = maxTicksPerFrame;
+	this->accumulator = 0.;
+}
+
 // create the main window
 void Engine::createMainWindow(int width, int height, const std::string& title) {
 	this->window.init(width, height, title);
@@ -55,7 +129,7 @@ void Engine::run() {
 	this->onCreate();
 
 	// set callback for rendering
-	this->window.setOnUpdate(std::bind(&Engine::onUpdate, this, std::placeholders::_1));
+	this->window.setOnUpdate(std::bind(&Engine::update, this, std::placeholders::_1));
 
 	while(true) {
 		// update window
@@ -83,6 +157,11 @@ void Engine::run() {
 			break;
 	}
 
+#ifdef PIXELS_COROUTINES
+	// stop all tasks before the application-specific data they might use will be destroyed
+	this->tasks.stop();
+#endif
+
 	this->onDestroy();
 }
 
@@ -101,11 +180,37 @@ double Engine::getTime() const {
 	return this->window.getTime();
 }
 
+// get the fixed timestep of the simulation in seconds (or zero if no fixed timestep is used)
+double Engine::getFixedTimestep() const {
+	return this->fixedTimestep;
+}
+
+// get the number of ticks that have been dropped so far, because too many ticks would have been needed in one frame
+std::size_t Engine::getDroppedTicks() const {
+	return this->droppedTicks;
+}
+
 // get the current rendering mode
 MainWindow::RenderingMode Engine::getRenderingMode() const {
 	return this->window.getRenderingMode();
 }
 
+// get which pixels are rendered every frame
+MainWindow::Interlacing Engine::getInterlacing() const {
+	return this->window.getInterlacing();
+}
+
+// get one of the previous frames, starting with the last one (age 1)
+//	NOTE:	The frames are in physical pixels, i.e. not scaled to the pixel size.
+const Pixels& Engine::getHistory(unsigned int age) const {
+	return this->window.getHistory(age);
+}
+
+// close the window after the current frame, ending Engine::run
+void Engine::close() {
+	this->window.close();
+}
+
 // clip x and y into window space
 void Engine::clip(int& x, int& y) {
 	if(x < 0)
@@ -134,6 +239,18 @@ void Engine::fill(int x1, int y1, int x2, int y2, unsigned char r, unsigned char
 			this->draw(x, y, r, g, b);
 }
 
+// draw a sprite from the specified atlas at the specified window position (x, y),
+//	optionally scaled by an integer factor and/or flipped (see Pixels::BLIT_FLIP_X and Pixels::BLIT_FLIP_Y)
+//	NOTE:	The color key of the atlas will be used if it has been set.
+void Engine::blit(const Atlas& atlas, std::size_t sprite, int x, int y, unsigned int scale, unsigned char flags) {
+	const auto& rect = atlas.getSprite(sprite);
+
+	if(atlas.hasColorKey())
+		flags |= Pixels::BLIT_COLOR_KEY;
+
+	this->window.blit(atlas.getPixels(), rect.x, rect.y, rect.w, rect.h, x, y, scale, flags, atlas.getColorKey());
+}
+
 // check whether a key has been pressed THIS frame
 bool Engine::isKeyPressed(unsigned int code) const {
 	return this->window.isKeyPressed(code);
@@ -154,3 +271,66 @@ bool Engine::isKeyReleased(unsigned int code) const {
 bool Engine::isKeyRepeated(unsigned int code) const {
 	return this->window.isKeyRepeated(code);
 }
+
+#ifdef PIXELS_COROUTINES
+
+// start the specified task, which will run on the main thread before onUpdate is called, starting with the next frame
+//	NOTE:	The task will be stopped when the engine stops, i.e. before onDestroy is called.
+//			An exception thrown inside the task will be rethrown by Engine::run.
+void Engine::startTask(Task task) {
+	this->tasks.start(std::move(task));
+}
+
+// wait for the next frame inside a task (i.e. co_await nextFrame())
+TaskScheduler::NextFrame Engine::nextFrame() {
+	return this->tasks.nextFrame();
+}
+
+// wait for the specified time (in seconds) inside a task (i.e. co_await seconds(t))
+TaskScheduler::Delay Engine::seconds(double seconds) {
+	return this->tasks.seconds(seconds);
+}
+
+// run the specified function in a background thread inside a task and wait for it to finish (i.e. co_await runInBackground(f))
+//	NOTE:	The function must not draw into the window, the task will be resumed on the main thread afterwards.
+TaskScheduler::Background Engine::runInBackground(std::function<void()> function) {
+	return this->tasks.runInBackground(std::move(function));
+}
+
+#endif /* PIXELS_COROUTINES */
+
+// update the frame, resuming the tasks and running the ticks of the simulation if a fixed timestep is used
+void Engine::update(double elapsedTime) {
+#ifdef PIXELS_COROUTINES
+	this->tasks.resume(this->window.getTime());
+#endif
+
+	this->onUpdate(elapsedTime);
+
+	if(this->fixedTimestep <= 0.)
+		return;
+
+	this->accumulator += elapsedTime;
+
+	unsigned int ticks = 0;
+
+	while(this->accumulator >= this->fixedTimestep) {
+		if(ticks == this->maxTicks) {
+			// drop the remaining ticks (keeping the elapsed share of the next tick)
+			const auto dropped = static_cast<std::size_t>(this->accumulator / this->fixedTimestep);
+
+			this->droppedTicks += dropped;
+			this->accumulator -= dropped * this->fixedTimestep;
+
+			break;
+		}
+
+		this->onFixedUpdate(this->fixedTimestep);
+
+		this->accumulator -= this->fixedTimestep;
+
+		++ticks;
+	}
+
+	this->onRender(std::min(this->accumulator / this->fixedTimestep, 1.));
+}
@@ -10,11 +10,25 @@
 
 #pragma once
 
+#include <algorithm>				// std::copy, std::min
+#include <cstddef>				// std::size_t
+#include <cstdint>				// uint32_t
+#include <functional>				// std::function
 #include <sstream>				// std::fixed, std::ostringstream
+#include <stdexcept>				// std::runtime_error
 #include <string>				// std::string
+#include <utility>				// std::move
+#include <vector>				// std::vector
 
+#include "Atlas.h"
+#include "Layer.h"
 #include "MainWindow.h"
 #include "PixelTest.h"
+#include "Progressive.h"
+#include "Task.h"
+
+// (see Image.h, which is only needed when images are used)
+class Image;
 
 class Engine {
 public:
@@ -23,10 +37,24 @@ public:
 
 	void setRenderingMode(MainWindow::RenderingMode mode);
 	void setClearBuffer(bool clear);
+	void setHugePages(Memory::HugePages hugePages);
 	void setPixelSize(unsigned short size);
 	void setPixelTest(const PixelTest& pixelTest);
 	void disablePixelTest();
+	void setInterlacing(
+			MainWindow::Interlacing interlacing,
+			MainWindow::Reconstruction reconstruction = MainWindow::RECONSTRUCTION_PREVIOUS
+	);
+	void setPostProcess(PostProcess * postProcess);
+	void addLayer(Layer * layer);
+	void removeLayer(Layer * layer);
+	void setRecorder(Recorder * recorder);
+	void setReplayer(Replayer * replayer);
+	void setSharedFrames(SharedFrames * sharedFrames);
+	void setMetrics(Metrics * metrics);
+	void setHistory(unsigned int frames);
 	void setDebugText(const std::string& string);
+	void setFixedTimestep(double ticksPerSecond, unsigned int maxTicksPerFrame = 5);
 
 	void createMainWindow(int width, int height, const std::string& title);
 
@@ -34,29 +62,192 @@ public:
 
 	// functions to overwrite
 	virtual void onCreate() = 0;
-	virtual void onUpdate(double elapsedTime) = 0;
+	virtual void onUpdate(double elapsedTime) { UNUSED(elapsedTime); };
+	virtual void onFixedUpdate(double dt) { UNUSED(dt); };
+	virtual void onRender(double alpha) { UNUSED(alpha); };
 	virtual void onDestroy() {};
 
 protected:
 	int getWindowWidth() const;
 	int getWindowHeight() const;
 	double getTime() const;
+	double getFixedTimestep() const;
+	std::size_t getDroppedTicks() const;
 	MainWindow::RenderingMode getRenderingMode() const;
+	MainWindow::Interlacing getInterlacing() const;
+	const Pixels& getHistory(unsigned int age) const;
 
+	void close();
 	void clip(int& x, int& y);
 	void draw(int x, int y, unsigned char r, unsigned char g, unsigned char b);
 	void fill(int x1, int y1, int x2, int y2, unsigned char r, unsigned char g, unsigned char b);
+	void blit(const Atlas& atlas, std::size_t sprite, int x, int y, unsigned int scale = 1, unsigned char flags = Pixels::BLIT_NONE);
+	void blit(const Image& image, int x, int y, unsigned int scale = 1, unsigned char flags = Pixels::BLIT_NONE);
+
+	template<typename Kernel> void shade(Kernel kernel);
+	template<unsigned int N = 8, typename Kernel> void shadeBatched(Kernel kernel);
+	template<typename Kernel> bool refine(Progressive& progressive, Kernel kernel);
 
 	bool isKeyPressed(unsigned int code) const;
 	bool isKeyHeld(unsigned int code) const;
 	bool isKeyReleased(unsigned int code) const;
 	bool isKeyRepeated(unsigned int code) const;
 
+#ifdef PIXELS_COROUTINES
+	void startTask(Task task);
+	TaskScheduler::NextFrame nextFrame();
+	TaskScheduler::Delay seconds(double seconds);
+	TaskScheduler::Background runInBackground(std::function<void()> function);
+#endif
+
 private:
+	void update(double elapsedTime);
+
 	MainWindow window;
+	std::vector<uint32_t, Memory::Allocator<uint32_t>> row;
 	double oldTime;
 	std::string debug;
 	bool debugChanged;
+
+	double fixedTimestep;
+	unsigned int maxTicks;
+	double accumulator;
+	std::size_t droppedTicks;
+
+#ifdef PIXELS_COROUTINES
+	TaskScheduler tasks;
+#endif
 };
 
+// evaluate the specified kernel for every pixel in the window, row by row
+//	NOTE:	The kernel will be called as kernel(int x, int y) and needs to return a packed color (see Pixels::pack).
+//			It will be inlined into the loop over one row, which can be vectorized by the compiler
+//			as long as the kernel itself does not call any non-inline functions.
+//			When interlacing is used, the kernel will only be called for the pixels of the current field
+//			and the other pixels will be reconstructed by the main window (see Engine::setInterlacing).
+template<typename Kernel> void Engine::shade(Kernel kernel) {
+	const int w = this->window.getWidth();
+	const int h = this->window.getHeight();
+
+	if(w <= 0 || h <= 0)
+		return;
+
+	const auto interlacing = this->window.getInterlacing();
+
+	if(interlacing != MainWindow::INTERLACING_NONE) {
+		const int field = this->window.getField();
+
+		for(int y = 0; y < h; ++y) {
+			uint32_t * out = this->window.getFieldRow(y);
+
+			if(interlacing == MainWindow::INTERLACING_CHECKERBOARD) {
+				for(int x = (y + field) & 1; x < w; x += 2)
+					out[x] = kernel(x, y);
+			}
+			else if((y & 1) == field)
+				for(int x = 0; x < w; ++x)
+					out[x] = kernel(x, y);
+		}
+
+		this->window.putField();
+
+		return;
+	}
+
+	this->row.resize(w);
+
+	uint32_t * out = this->row.data();
+
+	for(int y = 0; y < h; ++y) {
+		for(int x = 0; x < w; ++x)
+			out[x] = kernel(x, y);
+
+		this->window.putRow(0, y, out, w);
+	}
+}
+
+// evaluate the specified kernel for every pixel in the window, N pixels at a time
+//	NOTE:	The kernel will be called as kernel(int x, int y, uint32_t * out) and needs to write
+//			N packed colors (see Pixels::pack) for the pixels from x to x + N - 1 into out
+//			(for N = 8 or N = 16, out will be aligned to the size of the batch).
+//			It will always be given the full N pixels, i.e. surplus pixels at the end of a row will be ignored.
+//			When interlacing rows, the kernel will only be called for the rows of the current field.
+//			Checkerboard interlacing does not reduce the number of calls, because batches always consist of adjacent pixels.
+template<unsigned int N, typename Kernel> void Engine::shadeBatched(Kernel kernel) {
+	static_assert(N > 0, "Engine::shadeBatched(): the batch size needs to be positive");
+
+	const int w = this->window.getWidth();
+	const int h = this->window.getHeight();
+
+	if(w <= 0 || h <= 0)
+		return;
+
+	const int n = static_cast<int>(N);
+
+	this->row.resize((w + n - 1) / n * n);
+
+	uint32_t * out = this->row.data();
+
+	const auto interlacing = this->window.getInterlacing();
+
+	if(interlacing != MainWindow::INTERLACING_NONE) {
+		const int field = this->window.getField();
+
+		for(int y = 0; y < h; ++y) {
+			if(interlacing == MainWindow::INTERLACING_ROWS && (y & 1) != field)
+				continue;
+
+			for(int x = 0; x < w; x += n)
+				kernel(x, y, out + x);
+
+			uint32_t * to = this->window.getFieldRow(y);
+
+			if(interlacing == MainWindow::INTERLACING_CHECKERBOARD) {
+				for(int x = (y + field) & 1; x < w; x += 2)
+					to[x] = out[x];
+			}
+			else
+				std::copy(out, out + w, to);
+		}
+
+		this->window.putField();
+
+		return;
+	}
+
+	for(int y = 0; y < h; ++y) {
+		for(int x = 0; x < w; x += n)
+			kernel(x, y, out + x);
+
+		this->window.putRow(0, y, out, w);
+	}
+}
+
+// refine the specified progressive scene by evaluating the specified kernel for as many pixels
+//	as its time budget allows, and draw the whole scene, return whether it has been completely refined
+//	NOTE:	The kernel will be called as kernel(int x, int y) and needs to return a packed color (see Pixels::pack).
+//			The scene will be reset automatically when the size of the window changes,
+//			use Progressive::reset to start refining it again when its content changes.
+template<typename Kernel> bool Engine::refine(Progressive& progressive, Kernel kernel) {
+	const int w = this->window.getWidth();
+	const int h = this->window.getHeight();
+
+	if(w <= 0 || h <= 0)
+		return false;
+
+	progressive.begin(w, h);
+
+	int x = 0;
+	int y = 0;
+	int size = 0;
+
+	while(progressive.next(x, y, size))
+		progressive.set(x, y, size, kernel(x, y));
+
+	for(int row = 0; row < h; ++row)
+		this->window.putRow(0, row, progressive.getRow(row), w);
+
+	return progressive.isFinished();
+}
+
 #endif /* ENGINE_H_ */
@@ -0,0 +1,189 @@
+/*
+ * ExampleFractal.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "ExampleFractal.h"
+
+ExampleFractal::ExampleFractal()
+		: pixelSize(1),
+		  progressiveOn(true),
+		  centerX(-.5),
+		  centerY(0.),
+		  scale(3.),
+		  iterations(1024) {}
+
+ExampleFractal::~ExampleFractal() {}
+
+// run the application
+int ExampleFractal::run(int argc, char * argv[]) {
+	UNUSED(argc);
+	UNUSED(argv);
+
+	const std::string name("fractal");
+
+	constexpr int width = 800;
+	constexpr int height = 600;
+
+	this->setPixelSize(this->pixelSize);
+	this->updateDebugText();
+
+	this->createMainWindow(width, height, name);
+
+	this->Engine::run();
+
+	return EXIT_SUCCESS;
+}
+
+// create resources
+void ExampleFractal::onCreate() {}
+
+// update frame
+void ExampleFractal::onUpdate(double elapsedTime) {
+	// render the Mandelbrot set (progressively or all at once)
+	const auto kernel = [this](int x, int y) {
+		return this->renderPixel(x, y);
+	};
+
+	if(this->progressiveOn) {
+		const bool wasFinished = this->progressive.isFinished();
+
+		this->refine(this->progressive, kernel);
+
+		if(this->progressive.isFinished() != wasFinished)
+			this->updateDebugText();
+	}
+	else
+		this->shade(kernel);
+
+	// handle SPACE key for switching progressive rendering
+	if(this->isKeyPressed(GLFW_KEY_SPACE)) {
+		this->progressiveOn = !(this->progressiveOn);
+
+		this->progressive.reset();
+		this->updateDebugText();
+	}
+
+	// handle W/A/S/D keys for moving and PAGE UP/PAGE DOWN keys for zooming (resetting the progressive rendering)
+	const double step = this->scale * elapsedTime / 2.;
+	bool changed = false;
+
+	if(this->isKeyHeld(GLFW_KEY_A)) {
+		this->centerX -= step;
+
+		changed = true;
+	}
+
+	if(this->isKeyHeld(GLFW_KEY_D)) {
+		this->centerX += step;
+
+		changed = true;
+	}
+
+	if(this->isKeyHeld(GLFW_KEY_S)) {
+		this->centerY -= step;
+
+		changed = true;
+	}
+
+	if(this->isKeyHeld(GLFW_KEY_W)) {
+		this->centerY += step;
+
+		changed = true;
+	}
+
+	if(this->isKeyHeld(GLFW_KEY_PAGE_UP)) {
+		this->scale /= 1. + elapsedTime;
+
+		changed = true;
+	}
+
+	if(this->isKeyHeld(GLFW_KEY_PAGE_DOWN) && this->scale < 4.) {
+		this->scale *= 1. + elapsedTime;
+
+		changed = true;
+	}
+
+	if(changed) {
+		this->progressive.reset();
+		this->updateDebugText();
+	}
+
+	// handle UP/DOWN arrow keys for changing the 'pixel' size
+	const unsigned short oldPixelSize = this->pixelSize;
+
+	if(this->isKeyPressed(GLFW_KEY_UP) && this->pixelSize < 100)
+		++(this->pixelSize);
+
+	if(this->isKeyRepeated(GLFW_KEY_UP) && this->pixelSize < 100)
+		++(this->pixelSize);
+
+	if(this->isKeyPressed(GLFW_KEY_DOWN) && this->pixelSize > 1)
+		--(this->pixelSize);
+
+	if(this->isKeyRepeated(GLFW_KEY_DOWN) && this->pixelSize > 1)
+		--(this->pixelSize);
+
+	if(this->pixelSize != oldPixelSize)
+		this->setPixelSize(this->pixelSize);
+
+	// handle F10-F12 keys for changing the rendering mode
+	const auto currentRenderingMode = this->getRenderingMode();
+	auto newRenderingMode = currentRenderingMode;
+
+	if(this->isKeyPressed(GLFW_KEY_F10))
+		newRenderingMode = MainWindow::RENDERING_MODE_PBO;
+
+	if(this->isKeyPressed(GLFW_KEY_F11))
+		newRenderingMode = MainWindow::RENDERING_MODE_POINTS;
+
+	if(this->isKeyPressed(GLFW_KEY_F12))
+		newRenderingMode = MainWindow::RENDERING_MODE_TEXTURE;
+
+	if(newRenderingMode != currentRenderingMode)
+		this->setRenderingMode(newRenderingMode);
+}
+
+// render one pixel of the Mandelbrot set
+uint32_t ExampleFractal::renderPixel(int x, int y) const {
+	const int w = this->getWindowWidth();
+	const int h = this->getWindowHeight();
+	const double cx = this->centerX + (x - w / 2.) * this->scale / w;
+	const double cy = this->centerY + (y - h / 2.) * this->scale / w;
+
+	double zx = 0.;
+	double zy = 0.;
+	int n = 0;
+
+	while(n < this->iterations && zx * zx + zy * zy <= 4.) {
+		const double tmp = zx * zx - zy * zy + cx;
+
+		zy = 2. * zx * zy + cy;
+		zx = tmp;
+
+		++n;
+	}
+
+	if(n == this->iterations)
+		return Pixels::pack(0, 0, 0);
+
+	const unsigned char c = static_cast<unsigned char>(n * 8);
+
+	return Pixels::pack(c / 4, c / 2, c);
+}
+
+// show the rendering method and the current zoom in the window title
+void ExampleFractal::updateDebugText() {
+	std::ostringstream oss;
+
+	oss << (this->progressiveOn ? "progressive" : "immediate");
+
+	if(this->progressiveOn && !(this->progressive.isFinished()))
+		oss << " (refining)";
+
+	oss << ", zoom: " << std::fixed << std::setprecision(1) << 3. / this->scale << "x";
+
+	this->setDebugText(oss.str());
+}
@@ -0,0 +1,48 @@
+/*
+ * ExampleFractal.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef EXAMPLEFRACTAL_H_
+#define EXAMPLEFRACTAL_H_
+
+#pragma once
+
+#include "Engine.h"
+#include "Progressive.h"
+
+#include <cstdlib>		// EXIT_SUCCESS
+#include <iomanip>		// std::setprecision
+#include <sstream>		// std::fixed, std::ostringstream
+#include <string>		// std::string
+
+#define UNUSED(x) (void)(x)
+
+class ExampleFractal : Engine {
+public:
+	ExampleFractal();
+	virtual ~ExampleFractal();
+
+	int run(int argc, char * argv[]);
+
+private:
+	void onCreate() override;
+	void onUpdate(double elapsedTime) override;
+
+	uint32_t renderPixel(int x, int y) const;
+	void updateDebugText();
+
+	unsigned short pixelSize;
+
+	Progressive progressive;
+	bool progressiveOn;
+
+	double centerX;
+	double centerY;
+	double scale;
+	int iterations;
+};
+
+#endif /* EXAMPLEFRACTAL_H_ */
@@ -7,7 +7,12 @@
 
 #include "ExampleNoise.h"
 
-ExampleNoise::ExampleNoise() : pixelSize(2) {}
+ExampleNoise::ExampleNoise()
+		: pixelSize(2),
+		  interlacing(MainWindow::INTERLACING_NONE),
+		  reconstruction(MainWindow::RECONSTRUCTION_PREVIOUS),
+		  hashed(false),
+		  frame(0) {}
 
 ExampleNoise::~ExampleNoise() {}
 
@@ -22,7 +27,7 @@ int ExampleNoise::run(int argc, char * argv[]) {
 	constexpr int height = 600;
 
 	this->setPixelSize(this->pixelSize);
-	this->setDebugText(this->randGenerator.str());
+	this->updateDebugText();
 
 	this->createMainWindow(width, height, name);
 
@@ -38,20 +43,53 @@ void ExampleNoise::onCreate() {}
 void ExampleNoise::onUpdate(double elapsedTime) {
 	UNUSED(elapsedTime);
 
-	// render noise
-	const int w = this->getWindowWidth();
-	const int h = this->getWindowHeight();
+	if(this->hashed) {
+		// compute the noise for every pixel independently from its coordinates and the current frame
+		const uint32_t currentFrame = this->frame;
 
-	if(w > 0 && h > 0) {
-		for(int x = 0; x < w; ++x) {
-			for(int y = 0; y < h; ++y) {
-				const unsigned char r = this->randGenerator.generateByte();
-				const unsigned char g = this->randGenerator.generateByte();
-				const unsigned char b = this->randGenerator.generateByte();
+		this->shade([currentFrame](int x, int y) {
+			const uint32_t rgb = RandHash::get(0, x, y, currentFrame);
 
-				this->draw(x, y, r, g, b);
-			}
-		}
+			return Pixels::pack(rgb & 0xff, (rgb >> 8) & 0xff, (rgb >> 16) & 0xff);
+		});
+	}
+	else {
+		// generate the noise for all pixels shaded in this frame at once and render it (row by row)
+		//	NOTE:	When interlacing, only (up to) half of the pixels will be shaded, in the same order as the noise is used.
+		const std::size_t w = static_cast<std::size_t>(std::max(this->getWindowWidth(), 0));
+		const std::size_t h = static_cast<std::size_t>(std::max(this->getWindowHeight(), 0));
+		std::size_t pixels = w * h;
+
+		if(this->interlacing == MainWindow::INTERLACING_ROWS)
+			pixels = (h + 1) / 2 * w;
+		else if(this->interlacing == MainWindow::INTERLACING_CHECKERBOARD)
+			pixels = h * ((w + 1) / 2);
+
+		this->noise.resize(pixels * 3);
+
+		this->randGenerator.generateBytes(this->noise.data(), this->noise.size());
+
+		const unsigned char * rgb = this->noise.data();
+
+		this->shade([&rgb](int x, int y) {
+			UNUSED(x);
+			UNUSED(y);
+
+			const uint32_t color = Pixels::pack(rgb[0], rgb[1], rgb[2]);
+
+			rgb += 3;
+
+			return color;
+		});
+	}
+
+	++(this->frame);
+
+	// handle H key for switching between the pseudo-random number generator and hashed noise
+	if(this->isKeyPressed(GLFW_KEY_H)) {
+		this->hashed = !(this->hashed);
+
+		this->updateDebugText();
 	}
 
 	// handle SPACE key for changing the algorithm used for pseudo-random number generation
@@ -69,7 +107,22 @@ void ExampleNoise::onUpdate(double elapsedTime) {
 	if(newRandAlgo != oldRandAlgo) {
 		this->randGenerator.setAlgo(static_cast<Rand::Algo>(newRandAlgo));
 
-		this->setDebugText(this->randGenerator.str());
+		this->updateDebugText();
+	}
+
+	// handle I key for changing the interlacing and R key for changing the reconstruction of missing pixels
+	if(this->isKeyPressed(GLFW_KEY_I) || this->isKeyPressed(GLFW_KEY_R)) {
+		if(this->isKeyPressed(GLFW_KEY_I))
+			this->interlacing = static_cast<MainWindow::Interlacing>(
+					(this->interlacing + 1) % (MainWindow::INTERLACING_CHECKERBOARD + 1)
+			);
+
+		if(this->isKeyPressed(GLFW_KEY_R))
+			this->reconstruction = this->reconstruction == MainWindow::RECONSTRUCTION_PREVIOUS ?
+					MainWindow::RECONSTRUCTION_INTERPOLATE : MainWindow::RECONSTRUCTION_PREVIOUS;
+
+		this->setInterlacing(this->interlacing, this->reconstruction);
+		this->updateDebugText();
 	}
 
 	// handle UP/DOWN arrow keys for changing the 'pixel' size
@@ -106,3 +159,26 @@ void ExampleNoise::onUpdate(double elapsedTime) {
 	if(newRenderingMode != currentRenderingMode)
 		this->setRenderingMode(newRenderingMode);
 }
+
+// show the algorithm for pseudo-random number generation and the interlacing in the window title
+void ExampleNoise::updateDebugText() {
+	std::string text(this->hashed ? "hashed" : this->randGenerator.str());
+
+	if(this->interlacing == MainWindow::INTERLACING_NONE) {
+		this->setDebugText(text);
+
+		return;
+	}
+
+	if(this->interlacing == MainWindow::INTERLACING_ROWS)
+		text += ", interlaced rows";
+	else
+		text += ", checkerboard";
+
+	if(this->reconstruction == MainWindow::RECONSTRUCTION_INTERPOLATE)
+		text += " (interpolated)";
+	else
+		text += " (previous)";
+
+	this->setDebugText(text);
+}
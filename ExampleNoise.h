@@ -12,9 +12,14 @@
 
 #include "Engine.h"
 #include "Rand.h"
+#include "RandHash.h"
 
+#include <algorithm>		// std::max
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint32_t
 #include <cstdlib>		// EXIT_SUCCESS
 #include <string>		// std::string
+#include <vector>		// std::vector
 
 #define UNUSED(x) (void)(x)
 
@@ -29,9 +34,17 @@ private:
 	void onCreate() override;
 	void onUpdate(double elapsedTime) override;
 
+	void updateDebugText();
+
 	unsigned short pixelSize;
+	MainWindow::Interlacing interlacing;
+	MainWindow::Reconstruction reconstruction;
 
 	Rand randGenerator;
+	std::vector<unsigned char> noise;
+
+	bool hashed;
+	uint32_t frame;
 };
 
 #endif /* EXAMPLENOISE_H_ */
@@ -12,7 +12,9 @@ ExampleRects::ExampleRects()
 		  pixelSize(2),
 		  randomGenerator(Rand::RAND_ALGO_LEHMER32),
 		  renderBorders(false),
-		  testPixels(false) {}
+		  testPixels(false),
+		  rectsChanged(true),
+		  layer(Layer::BLEND_MODE_REPLACE) {}
 
 ExampleRects::~ExampleRects() {}
 
@@ -37,7 +39,10 @@ int ExampleRects::run(int argc, char * argv[]) {
 }
 
 // create resources
-void ExampleRects::onCreate() {}
+void ExampleRects::onCreate() {
+	// render the rectangles into a layer, which will only be composited again when they have changed
+	this->addLayer(&(this->layer));
+}
 
 // update frame
 void ExampleRects::onUpdate(double elapsedTime) {
@@ -47,13 +52,19 @@ void ExampleRects::onUpdate(double elapsedTime) {
 	const int w = this->getWindowWidth();
 	const int h = this->getWindowHeight();
 
-	if(this->testPixels) // draw backwards if pixel testing is enabled
+	if(this->testPixels) // draw backwards and directly if pixel testing is enabled
 		for(auto it = this->rects.rbegin(); it != this->rects.rend(); ++it)
 			this->render(w, h, *it);
-	else
+	else if(this->rectsChanged || this->layer.isReset()) {
+		// re-draw the layer only if necessary
+		this->layer.clear();
+
 		for(const auto& rect : this->rects)
 			this->render(w, h, rect);
 
+		this->rectsChanged = false;
+	}
+
 	// show number of rectangles and whether pixel testing is enabled
 	std::string debugStr("n=");
 
@@ -72,16 +83,25 @@ void ExampleRects::onUpdate(double elapsedTime) {
 		this->add();
 
 	// handle ESCAPE key for removing all rectangles
-	if(this->isKeyPressed(GLFW_KEY_ESCAPE))
+	if(this->isKeyPressed(GLFW_KEY_ESCAPE)) {
 		this->rects.clear();
 
-	if(this->isKeyRepeated(GLFW_KEY_ESCAPE))
+		this->rectsChanged = true;
+	}
+
+	if(this->isKeyRepeated(GLFW_KEY_ESCAPE)) {
 		this->rects.clear();
 
+		this->rectsChanged = true;
+	}
+
 	// handle SPACE key for toggling drawing the borders of the rectangles
-	if(this->isKeyPressed(GLFW_KEY_SPACE))
+	if(this->isKeyPressed(GLFW_KEY_SPACE)) {
 		this->renderBorders = !(this->renderBorders);
 
+		this->rectsChanged = true;
+	}
+
 	// handle TAB key for toggling pixel testing
 	if(this->isKeyPressed(GLFW_KEY_TAB)) {
 		this->testPixels = !(this->testPixels);
@@ -95,9 +115,17 @@ void ExampleRects::onUpdate(double elapsedTime) {
 			pixelTest.test = std::bind(&ExampleRects::pixelTestTest, this, std::placeholders::_1, std::placeholders::_2);
 
 			this->setPixelTest(pixelTest);
+
+			// draw directly instead of using the layer
+			this->removeLayer(&(this->layer));
 		}
-		else
+		else {
 			this->disablePixelTest();
+
+			this->addLayer(&(this->layer));
+
+			this->rectsChanged = true;
+		}
 	}
 
 	// handle UP/DOWN arrow keys for changing the 'pixel' size
@@ -159,6 +187,8 @@ void ExampleRects::add() {
 		std::swap(newRect.y1, newRect.y2);
 
 	Geometry::addAndSplit(this->rects, newRect, minSize);
+
+	this->rectsChanged = true;
 }
 
 // render one rectangle
@@ -175,29 +205,45 @@ void ExampleRects::render(int w, int h, const Rect& rect) {
 
 		for(int x = absX1; x < absX2; ++x) {
 			if(absY1 < h)
-				this->draw(x, absY1, borderR, borderG, borderB);
+				this->renderPixel(x, absY1, borderR, borderG, borderB);
 
 			if(absY2 > 0)
-				this->draw(x, absY2 - 1, borderR, borderG, borderB);
+				this->renderPixel(x, absY2 - 1, borderR, borderG, borderB);
 		}
 
 		for(int y = absY1; y < absY2; ++y) {
 			if(absX1 < w)
-				this->draw(absX1, y, borderR, borderG, borderB);
+				this->renderPixel(absX1, y, borderR, borderG, borderB);
 
 			if(absX2 > 0)
-				this->draw(absX2 - 1, y, borderR, borderG, borderB);
+				this->renderPixel(absX2 - 1, y, borderR, borderG, borderB);
 		}
 
 		if(absX2 > 0 && absY2 > 0)
-			this->fill(absX1 + 1, absY1 + 1, absX2 - 1, absY2 - 1, rect.c.r, rect.c.g, rect.c.b);
+			this->renderArea(absX1 + 1, absY1 + 1, absX2 - 1, absY2 - 1, rect.c.r, rect.c.g, rect.c.b);
 		else if(absX2 > 0)
-			this->fill(absX1 + 1, absY1 + 1, absX2 - 1, 0, rect.c.r, rect.c.g, rect.c.b);
+			this->renderArea(absX1 + 1, absY1 + 1, absX2 - 1, 0, rect.c.r, rect.c.g, rect.c.b);
 		else if(absY2 > 0)
-			this->fill(absX1 + 1, absY1 + 1, 0, absY2 - 1, rect.c.r, rect.c.g, rect.c.b);
+			this->renderArea(absX1 + 1, absY1 + 1, 0, absY2 - 1, rect.c.r, rect.c.g, rect.c.b);
 	}
 	else
-		this->fill(absX1, absY1, absX2, absY2, rect.c.r, rect.c.g, rect.c.b);
+		this->renderArea(absX1, absY1, absX2, absY2, rect.c.r, rect.c.g, rect.c.b);
+}
+
+// render one pixel, either into the layer or directly (when testing pixels)
+void ExampleRects::renderPixel(int x, int y, unsigned char r, unsigned char g, unsigned char b) {
+	if(this->testPixels)
+		this->draw(x, y, r, g, b);
+	else
+		this->layer.set(x, y, r, g, b);
+}
+
+// render an area, either into the layer or directly (when testing pixels)
+void ExampleRects::renderArea(int x1, int y1, int x2, int y2, unsigned char r, unsigned char g, unsigned char b) {
+	if(this->testPixels)
+		this->fill(x1, y1, x2, y2, r, g, b);
+	else
+		this->layer.fill(x1, y1, x2, y2, r, g, b);
 }
 
 // pixel test initialization
@@ -12,6 +12,7 @@
 
 #include "Engine.h"
 #include "Geometry.h"
+#include "Layer.h"
 #include "Rand.h"
 
 #include <cmath>		// std::lround
@@ -48,6 +49,8 @@ private:
 
 	void add();
 	void render(int w, int h, const Rect& rect);
+	void renderPixel(int x, int y, unsigned char r, unsigned char g, unsigned char b);
+	void renderArea(int x1, int y1, int x2, int y2, unsigned char r, unsigned char g, unsigned char b);
 
 	void pixelTestInit(unsigned int w, unsigned int h);
 	void pixelTestFrame();
@@ -62,6 +65,9 @@ private:
 	bool testPixels;
 
 	std::vector<Rect> rects;
+	bool rectsChanged;
+
+	Layer layer;
 };
 
 #endif /* EXAMPLERECTS_H_ */
@@ -9,18 +9,23 @@
 
 // constructor
 ExampleSound::ExampleSound()
-		: pixelSize(2),
+		: startup(std::chrono::steady_clock::now()),
+		  pixelSize(2),
 		  waveResolution(10),
 		  masterVolume(0.7),
 		  maxVolume(0.8),
 		  randomGenerator(Rand::RAND_ALGO_LEHMER32),
 		  noiseGenerator(Rand::RAND_ALGO_LEHMER32),
+		  metricVoices(nullptr),
 		  commandsToIntermediary(maxSoundWaves),
 		  soundWavesToAudioThread(maxSoundWaves),
 		  indexNextSoundWaveIntermediary(0),
 		  indexNextSoundWaveAudioThread(0),
 		  isClearSoundWaves(false),
-		  numSoundWaves(0) {
+		  numSoundWaves(0),
+		  isFirstFrameReported(false),
+		  isFirstSampleReported(false),
+		  isOutputReported(false) {
 	// setup random generators
 	this->randomGenerator.setRealLimits(0.1, 1.5);		// wave lengths between 0.1 and 1.5 seconds
 	this->randomGenerator.setByteLimits(0, 47);			// 48 tones over three octaves
@@ -31,20 +36,11 @@ ExampleSound::ExampleSound()
 ExampleSound::~ExampleSound() {}
 
 // run the application
+//	NOTE:	If a path is specified as first argument, the metrics will be exported into a file at that path every second,
+//			or served via a Unix domain socket if the path starts with 'unix:'.
 int ExampleSound::run(int argc, char * argv[]) {
-	UNUSED(argc);
-	UNUSED(argv);
-
-	// setup the engine
 	const std::string name("sound");
 
-	constexpr int width = 800;
-	constexpr int height = 600;
-
-	this->setClearBuffer(true);
-	this->setPixelSize(this->pixelSize);
-	this->createMainWindow(width, height, name);
-
 	// setup the sound system
 	this->soundSystem.setOutputStreamName(name);
 	this->soundSystem.setOutputFunction(
@@ -57,6 +53,50 @@ int ExampleSound::run(int argc, char * argv[]) {
 			)
 	);
 
+	// setup the metrics
+	this->setMetrics(&(this->metrics));
+	this->soundSystem.setMetrics(&(this->metrics));
+
+	this->metricVoices = &(this->metrics.addGauge("pixels_audio_voices", "Number of active sound waves."));
+
+	if(argc > 1) {
+		const std::string path(argv[1]);
+		const std::string socketPrefix("unix:");
+
+		if(path.compare(0, socketPrefix.size(), socketPrefix) == 0)
+			this->metrics.exportToSocket(path.substr(socketPrefix.size()), 1.);
+		else
+			this->metrics.exportToFile(path, 1.);
+	}
+
+	// run the sound threads on the last CPU with real-time priority and keep all other threads off it
+	//	NOTE:	Threads started by the main thread afterwards (e.g. the intermediary thread) will inherit its affinity.
+	const unsigned int soundCPU = ThreadConfig::getLastCPU();
+
+	ThreadConfig soundConfig;
+	ThreadConfig mainConfig;
+
+	soundConfig.setRealTime(ExampleSound::soundPriority);
+	soundConfig.setAffinity({ soundCPU });
+	soundConfig.setLockMemory(ExampleSound::soundLockMemory);
+
+	mainConfig.setAffinity(ThreadConfig::getCPUsExcept(soundCPU));
+
+	this->soundSystem.setThreadConfig(soundConfig);
+
+	ExampleSound::printThreadConfigErrors("main", mainConfig.apply());
+
+	// start the sound system, which will open the output stream while the window is being created
+	//	NOTE:	The time of the window starts with its creation, i.e. at (almost) the same time as the time of the sound.
+	this->soundSystem.start(0.);
+
+	// setup the engine
+	constexpr int width = 800;
+	constexpr int height = 600;
+
+	this->setPixelSize(this->pixelSize);
+	this->createMainWindow(width, height, name);
+
 	// run the engine
 	this->Engine::run();
 
@@ -87,14 +127,12 @@ void ExampleSound::setMaxVolume(double max) {
 
 // create resources
 void ExampleSound::onCreate() {
-	// start the sound system
-	this->soundSystem.start(this->getTime());
-
-	// wait for the sound system to be ready
-	while(!(this->soundSystem.isStarted()))
-		std::this_thread::yield();
+	// start intermediary thread
+	this->intermediary = std::thread(&ExampleSound::threadIntermediary, this);
+}
 
-	// query for information about the sound output and print it to stdout
+// print information about the sound output to stdout
+void ExampleSound::printOutputInfo() {
 	std::cout << "device=" << this->soundSystem.getOutputDeviceName() << std::endl;
 	std::cout << "samplerate=" << this->soundSystem.getOutputSampleRate() << std::endl;
 
@@ -113,56 +151,103 @@ void ExampleSound::onCreate() {
 
 	for(auto channel = 0; channel < channels; ++channel)
 		std::cout << "\t#" << channel << ": " << this->soundSystem.getOutputChannelName(channel) << std::endl;
+}
 
-	// start intermediary thread
-	this->intermediary = std::thread(&ExampleSound::threadIntermediary, this);
+// print the errors that occured while configuring the specified thread (if any) to stderr
+void ExampleSound::printThreadConfigErrors(const std::string& thread, const std::string& errors) {
+	if(!errors.empty())
+		std::cerr << "Could not configure " << thread << " thread: " << errors << std::endl;
+}
+
+// print the time since startup (in milliseconds) to stdout
+void ExampleSound::printStartupTime(const std::string& what, std::chrono::steady_clock::time_point time) {
+	std::cout
+			<< what
+			<< "="
+			<< std::chrono::duration<double, std::milli>(time - this->startup).count()
+			<< "ms"
+			<< std::endl;
 }
 
 // update frame
 void ExampleSound::onUpdate(double elapsedTime) {
 	UNUSED(elapsedTime);
 
+	// report the startup times and the sound output once available (without waiting for the sound system)
+	if(!(this->isFirstFrameReported)) {
+		this->printStartupTime("first_frame", std::chrono::steady_clock::now());
+
+		this->isFirstFrameReported = true;
+	}
+
+	if(!(this->isOutputReported) && this->soundSystem.isStarted()) {
+		this->printOutputInfo();
+
+		this->isOutputReported = true;
+	}
+
+	std::string threadConfigErrors;
+
+	if(this->soundSystem.isThreadConfigErrorsOccured(threadConfigErrors))
+		ExampleSound::printThreadConfigErrors("sound", threadConfigErrors);
+
+	if(!(this->isFirstSampleReported)) {
+		const auto firstSample = this->soundSystem.getFirstSampleTime();
+
+		if(firstSample.time_since_epoch().count()) {
+			this->printStartupTime("first_sample", firstSample);
+
+			this->isFirstSampleReported = true;
+		}
+	}
+
 	const double currentTime = this->getTime();
 
-	// render sound wave
+	// calculate the sound wave, i.e. the rows to be filled in each column
 	const auto w = this->getWindowWidth();
 	const auto h = this->getWindowHeight();
 	const double res = static_cast<double>(this->waveResolution) / 1000.;
 	const double halfHeight = static_cast<double>(h) / 2;
+	const int center = static_cast<int>(std::lround(halfHeight));
+
+	this->waveFrom.resize(w);
+	this->waveTo.resize(w);
 
 	for(int x = 0; x < w; ++x) {
 		const double sound = this->generateSound(0, currentTime + static_cast<double>(x) / w * res);
 
-		int yFrom = static_cast<int>(std::lround(halfHeight));
-		int yTo = static_cast<int>(std::lround(halfHeight + sound * halfHeight));
-		bool swapped = false;
+		this->waveFrom[x] = center;
+		this->waveTo[x] = static_cast<int>(std::lround(halfHeight + sound * halfHeight));
 
-		if(yFrom > yTo) {
+		if(this->waveFrom[x] > this->waveTo[x]) {
 			using std::swap;
 
-			swap(yFrom, yTo);
-
-			swapped = true;
+			swap(this->waveFrom[x], this->waveTo[x]);
 		}
+	}
 
-		for(int y = yFrom; y <= yTo; ++y) {
-			double red = 0.;
+	// calculate the color of each row (depending on its distance from the center)
+	this->waveColors.resize(h);
 
-			if(swapped)
-				red = static_cast<double>(yTo - y) / halfHeight;
-			else
-				red = static_cast<double>(y - yFrom) / halfHeight;
+	for(int y = 0; y < h; ++y) {
+		const double red = std::min(static_cast<double>(std::abs(y - center)) / halfHeight, 1.);
 
-			this->draw(
-					x,
-					y,
-					static_cast<unsigned char>(std::lround(255 * red)),
-					static_cast<unsigned char>(std::lround(255 - 255 * red)),
-					0
-			);
-		}
+		this->waveColors[y] = Pixels::pack(
+				static_cast<unsigned char>(std::lround(255 * red)),
+				static_cast<unsigned char>(std::lround(255 - 255 * red)),
+				0
+		);
 	}
 
+	// render sound wave (row by row)
+	const int * from = this->waveFrom.data();
+	const int * to = this->waveTo.data();
+	const uint32_t * colors = this->waveColors.data();
+
+	this->shade([from, to, colors](int x, int y) {
+		return (y >= from[x] && y <= to[x]) ? colors[y] : Pixels::pack(0, 0, 0);
+	});
+
 	// check for errors
 	std::string writingError, errorString;
 
@@ -171,6 +256,9 @@ void ExampleSound::onUpdate(double elapsedTime) {
 	else if(this->soundSystem.isOutputWritingErrorsOccured(writingError))
 		errorString += ", ERROR: " + writingError;
 
+	// update the metrics
+	this->metricVoices->set(this->numSoundWaves);
+
 	// show number of sound waves and current wave resolution
 	this->setDebugText(
 			"n="
@@ -299,12 +387,21 @@ void ExampleSound::onDestroy() {
 void ExampleSound::threadIntermediary() {
 	bool running = true;
 
+	// commands waiting for the output stream to be started (i.e. for its sample rate)
+	std::vector<Command> waiting;
+
 	do {
-		// get commands
+		// get commands (after the waiting ones, if the output stream has been started in the meantime)
 		std::vector<Command> commands;
 
 		this->commandsToIntermediary.pop(commands);
 
+		if(!waiting.empty() && this->soundSystem.isReady()) {
+			commands.insert(commands.begin(), waiting.begin(), waiting.end());
+
+			waiting.clear();
+		}
+
 		for(const auto& command : commands) {
 			switch(command.action) {
 			case ACTION_NONE:
@@ -340,11 +437,23 @@ void ExampleSound::threadIntermediary() {
 				break;
 
 			case ACTION_ADD_NOISE:
-				this->addSoundWave(SoundWave::SOUNDWAVE_NOISE_PRECALCULATED);
+				// noise needs the sample rate, which is only known after the output stream has been started
+				//	NOTE:	Errors of the sound system will be reported by the main thread (see ExampleSound::onUpdate),
+				//			i.e. the noise will be dropped if the sound system fails in the meantime.
+				if(waiting.empty() && this->soundSystem.isReady()) {
+					try {
+						this->addSoundWave(SoundWave::SOUNDWAVE_NOISE_HASHED);
+					}
+					catch(const std::runtime_error&) {}
+				}
+				else
+					waiting.push_back(command);
 
 				break;
 
 			case ACTION_CLEAR:
+				waiting.clear();
+
 				this->clearSoundWaves();
 
 				break;
@@ -384,12 +493,23 @@ void ExampleSound::addSoundWave(SoundWave::Type type) {
 	const SoundEnvelope envelope(SoundEnvelope::ADRTimes(0.1, 0.01, 0.2), 1., 0.8);
 
 	// generate noise if necessary
-	std::vector<double> noise;
+	SoundWave::Noise noise;
 	double samplesPerSecond = 0.;
+	uint64_t noiseSeed = 0;
+
+	if(type == SoundWave::SOUNDWAVE_NOISE_PRECALCULATED || type == SoundWave::SOUNDWAVE_NOISE_HASHED) {
+		// the sample rate is only known after the output stream has been started (see ExampleSound::threadIntermediary)
+		if(!(this->soundSystem.isReady()))
+			throw std::runtime_error("ExampleSound::addSoundWave(): output stream has not been started yet");
 
-	if(type == SoundWave::SOUNDWAVE_NOISE_PRECALCULATED) {
 		samplesPerSecond = this->soundSystem.getOutputSampleRate() / (length + envelope.getADRTimes().decayTime);
+	}
 
+	// hashed noise only needs a seed, which will be shared by both copies of the sound wave
+	if(type == SoundWave::SOUNDWAVE_NOISE_HASHED)
+		noiseSeed = static_cast<uint64_t>(this->noiseGenerator.generateInt());
+
+	if(type == SoundWave::SOUNDWAVE_NOISE_PRECALCULATED) {
 		const auto samples =
 				static_cast<std::size_t>(
 						(length + envelope.getADRTimes().releaseTime) * samplesPerSecond * noiseResolution
@@ -410,6 +530,7 @@ void ExampleSound::addSoundWave(SoundWave::Type type) {
 			samplesPerSecond
 	);
 
+	soundWaveForThread.setNoiseSeed(noiseSeed);
 	soundWaveForThread.start(start);
 
 	// try to add the sound wave to the circular buffer that communicates with the sound thread
@@ -432,6 +553,7 @@ void ExampleSound::addSoundWave(SoundWave::Type type) {
 				samplesPerSecond
 		);
 
+		newSoundWave.setNoiseSeed(noiseSeed);
 		newSoundWave.start(start);
 
 		using std::swap;
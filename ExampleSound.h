@@ -12,18 +12,22 @@
 
 #include "ConcurrentCircular.h"
 #include "Engine.h"
+#include "Metrics.h"
 #include "Rand.h"
 #include "Sound.h"
 #include "SoundEnvelope.h"
 #include "SoundWave.h"
+#include "ThreadConfig.h"
 
-#include <algorithm>	// std::swap
+#include <algorithm>	// std::min, std::swap
 #include <atomic>		// std::atomic, std::memory_order
+#include <chrono>		// std::chrono
 #include <cmath>		// std::lround, std::pow
 #include <cstddef>		// std::size_t
-#include <cstdlib>		// EXIT_SUCCESS
+#include <cstdint>		// uint32_t, uint64_t
+#include <cstdlib>		// std::abs, EXIT_SUCCESS
 #include <functional>	// std::bind, std::placeholders
-#include <iostream>		// std::cout, std::endl
+#include <iostream>		// std::cerr, std::cout, std::endl
 #include <mutex>		// std::lock_guard, std::mutex, std::try_to_lock, std::unique_lock
 #include <stdexcept>	// std::runtime_error
 #include <string>		// std::string, std::to_string
@@ -34,6 +38,11 @@
 
 class ExampleSound : Engine {
 	static constexpr unsigned char maxSoundWaves = 20;
+	static constexpr int soundPriority = 20;
+
+	// locking all (current and future) memory is opt-in, because later mappings (e.g. of the pixel buffer) might fail
+	//	when exceeding RLIMIT_MEMLOCK
+	static constexpr bool soundLockMemory = false;
 
 	enum Action {
 		ACTION_NONE,
@@ -69,6 +78,11 @@ private:
 	void onUpdate(double elapsedTime) override;
 	void onDestroy() override;
 
+	void printOutputInfo();
+	void printStartupTime(const std::string& what, std::chrono::steady_clock::time_point time);
+
+	static void printThreadConfigErrors(const std::string& thread, const std::string& errors);
+
 	void threadIntermediary();
 
 	void addSoundWave(SoundWave::Type type);
@@ -77,13 +91,23 @@ private:
 	double generateSound(unsigned int channel, double time, bool forThread = false);
 	double generateSoundFrom(double time, SoundWave * from, std::size_t n, bool count = false);
 
+	std::chrono::steady_clock::time_point startup;
+
 	unsigned short pixelSize;
 	unsigned short waveResolution;
+
+	std::vector<int> waveFrom;
+	std::vector<int> waveTo;
+	std::vector<uint32_t> waveColors;
+
 	double masterVolume;
 	double maxVolume;
 
 	Rand randomGenerator;
 	Rand noiseGenerator;
+	Metrics metrics;
+	Metrics::Gauge * metricVoices;
+
 	Sound soundSystem;
 
 	/*
@@ -111,6 +135,10 @@ private:
 	std::atomic<bool> isClearSoundWaves;
 
 	unsigned char numSoundWaves;
+
+	bool isFirstFrameReported;
+	bool isFirstSampleReported;
+	bool isOutputReported;
 };
 
 #endif /* EXAMPLERECTS_H_ */
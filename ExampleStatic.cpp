@@ -0,0 +1,55 @@
+/*
+ * ExampleStatic.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#include "ExampleStatic.h"
+
+ExampleStatic::ExampleStatic() : animationTime(0.), paused(false) {}
+
+ExampleStatic::~ExampleStatic() {}
+
+// run the application
+int ExampleStatic::run(int argc, char * argv[]) {
+	UNUSED(argc);
+	UNUSED(argv);
+
+	const std::string name("static");
+
+	constexpr int width = 800;
+	constexpr int height = 600;
+
+	this->createMainWindow(width, height, name);
+
+	this->StaticEngine::run();
+
+	return EXIT_SUCCESS;
+}
+
+// create resources
+void ExampleStatic::onCreate() {}
+
+// update frame
+void ExampleStatic::onUpdate(double elapsedTime) {
+	// handle SPACE for pausing the animation
+	if(this->isKeyPressed(GLFW_KEY_SPACE))
+		this->paused = !(this->paused);
+
+	if(!(this->paused))
+		this->animationTime += elapsedTime;
+
+	// draw a moving XOR pattern (the kernel will be inlined into the loop over each row)
+	const int t = static_cast<int>(this->animationTime * 60.);
+
+	this->shade([t](int x, int y) {
+		return Pixels::pack(
+				static_cast<unsigned char>((x + t) ^ y),
+				static_cast<unsigned char>(x ^ (y + t)),
+				static_cast<unsigned char>((x ^ y) + t)
+		);
+	});
+
+	this->setDebugText(this->paused ? "paused" : "");
+}
@@ -0,0 +1,38 @@
+/*
+ * ExampleStatic.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef EXAMPLESTATIC_H_
+#define EXAMPLESTATIC_H_
+
+#pragma once
+
+#include "StaticEngine.h"
+
+#include <cstdlib>		// EXIT_SUCCESS
+#include <string>		// std::string
+
+#define UNUSED(x) (void)(x)
+
+// the rendering mode and the pixel size are resolved at compile time
+class ExampleStatic : public StaticEngine<ExampleStatic, MainWindow::RENDERING_MODE_TEXTURE, 2> {
+	friend class StaticEngine<ExampleStatic, MainWindow::RENDERING_MODE_TEXTURE, 2>;
+
+public:
+	ExampleStatic();
+	virtual ~ExampleStatic();
+
+	int run(int argc, char * argv[]);
+
+private:
+	void onCreate();
+	void onUpdate(double elapsedTime);
+
+	double animationTime;
+	bool paused;
+};
+
+#endif /* EXAMPLESTATIC_H_ */
@@ -0,0 +1,774 @@
+/*
+ * Image.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "Image.h"
+
+#include "Engine.h"	// (only for Engine::blit, which is defined here to keep Engine.h free of zlib)
+
+// constructors and destructor
+Image::Image() : mapped(nullptr), mappedSize(0) {}
+
+Image::Image(const std::string& fileName, const std::string& cacheDirectory) : Image() {
+	this->load(fileName, cacheDirectory);
+}
+
+Image::~Image() {
+	this->clear();
+}
+
+// load an image from the specified file, using the specified directory for caching the decoded pixels if not empty
+void Image::load(const std::string& fileName, const std::string& cacheDirectory) {
+	this->clear();
+
+	// get size and modification time of the file to check whether the cache is still valid
+	struct stat fileStatus;
+
+	if(stat(fileName.c_str(), &fileStatus))
+		throw std::runtime_error("Image::load(): could not open '" + fileName + "'");
+
+	CacheHeader header{};
+
+	header.magic = Image::cacheMagic;
+	header.version = Image::cacheVersion;
+	header.fileSize = static_cast<uint64_t>(fileStatus.st_size);
+	header.fileTime = static_cast<int64_t>(fileStatus.st_mtim.tv_sec) * 1000000000 + fileStatus.st_mtim.tv_nsec;
+	header.nameHash = Image::hash(fileName);
+
+	std::string cacheFile;
+
+	if(!cacheDirectory.empty()) {
+		char name[17] = { 0 };
+
+		for(int n = 0; n < 16; ++n)
+			name[n] = "0123456789abcdef"[(header.nameHash >> (60 - n * 4)) & 0xf];
+
+		cacheFile = cacheDirectory + "/" + name + ".pixels";
+
+		if(this->loadCache(cacheFile, header))
+			return;
+	}
+
+	// read and decode the file
+	std::ifstream in(fileName, std::ios::binary);
+
+	if(!in)
+		throw std::runtime_error("Image::load(): could not open '" + fileName + "'");
+
+	const std::vector<unsigned char> data{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+
+	switch(Image::detect(data)) {
+	case FORMAT_PPM:
+		this->decodePPM(data);
+
+		break;
+
+	case FORMAT_PNG:
+		this->decodePNG(data);
+
+		break;
+
+	case FORMAT_QOI:
+		this->decodeQOI(data);
+
+		break;
+
+	default:
+		throw std::runtime_error("Image::load(): unknown format of '" + fileName + "'");
+	}
+
+	// write the decoded pixels into the cache if necessary
+	if(!cacheFile.empty()) {
+		mkdir(cacheDirectory.c_str(), 0755);
+
+		header.width = this->pixels.getWidth();
+		header.height = this->pixels.getHeight();
+
+		this->saveCache(cacheFile, header);
+	}
+}
+
+// release the pixels of the image
+void Image::clear() {
+	this->pixels.deallocate();
+	this->pixels.unmap();
+
+	if(this->mapped) {
+		munmap(this->mapped, this->mappedSize);
+
+		this->mapped = nullptr;
+		this->mappedSize = 0;
+	}
+}
+
+// get the width of the image
+int Image::getWidth() const {
+	return this->pixels ? this->pixels.getWidth() : 0;
+}
+
+// get the height of the image
+int Image::getHeight() const {
+	return this->pixels ? this->pixels.getHeight() : 0;
+}
+
+// get the pixels of the image
+const Pixels& Image::getPixels() const {
+	return this->pixels;
+}
+
+// get whether the pixels have been mapped from the cache
+bool Image::isCached() const {
+	return this->mapped != nullptr;
+}
+
+// get whether an image has been loaded
+Image::operator bool() const {
+	return static_cast<bool>(this->pixels);
+}
+
+// detect the format of an image by its first bytes
+Image::Format Image::detect(const std::vector<unsigned char>& data) {
+	constexpr unsigned char pngSignature[] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+
+	if(data.size() >= sizeof pngSignature && !std::memcmp(data.data(), pngSignature, sizeof pngSignature))
+		return FORMAT_PNG;
+
+	if(data.size() >= 4 && !std::memcmp(data.data(), "qoif", 4))
+		return FORMAT_QOI;
+
+	if(data.size() >= 2 && data[0] == 'P' && (data[1] == '2' || data[1] == '3' || data[1] == '5' || data[1] == '6'))
+		return FORMAT_PPM;
+
+	return FORMAT_UNKNOWN;
+}
+
+// decode a (binary or ASCII) PPM or PGM image
+void Image::decodePPM(const std::vector<unsigned char>& data) {
+	std::size_t pos = 2;
+
+	// read the next number, skipping whitespaces and comments
+	const auto number = [&data, &pos]() {
+		while(pos < data.size()) {
+			if(data[pos] == '#')
+				while(pos < data.size() && data[pos] != '\n')
+					++pos;
+			else if(data[pos] == ' ' || (data[pos] >= '\t' && data[pos] <= '\r'))
+				++pos;
+			else
+				break;
+		}
+
+		if(pos >= data.size() || data[pos] < '0' || data[pos] > '9')
+			throw std::runtime_error("Image::decodePPM(): invalid or truncated file");
+
+		uint64_t value = 0;
+
+		while(pos < data.size() && data[pos] >= '0' && data[pos] <= '9' && value <= 0xffffffff)
+			value = value * 10 + (data[pos++] - '0');
+
+		return value;
+	};
+
+	const bool ascii = data[1] == '2' || data[1] == '3';
+	const int channels = (data[1] == '3' || data[1] == '6') ? 3 : 1;
+	const uint64_t w = number();
+	const uint64_t h = number();
+	const uint64_t maxValue = number();
+
+	if(!maxValue || maxValue > 65535)
+		throw std::runtime_error("Image::decodePPM(): invalid maximum value");
+
+	// skip the single whitespace before the binary data
+	if(!ascii)
+		++pos;
+
+	const std::size_t sampleSize = maxValue > 255 ? 2 : 1;
+
+	this->create(w, h);
+
+	if(!ascii && data.size() < pos + w * h * channels * sampleSize)
+		throw std::runtime_error("Image::decodePPM(): truncated file");
+
+	for(int y = 0; y < this->pixels.getHeight(); ++y) {
+		auto * to = this->row(y);
+
+		for(int x = 0; x < this->pixels.getWidth(); ++x, to += 4) {
+			for(int channel = 0; channel < channels; ++channel) {
+				uint64_t value = 0;
+
+				if(ascii)
+					value = number();
+				else if(sampleSize == 2) {
+					value = (data[pos] << 8) | data[pos + 1];
+
+					pos += 2;
+				}
+				else
+					value = data[pos++];
+
+				if(value > maxValue)
+					throw std::runtime_error("Image::decodePPM(): invalid value");
+
+				to[channel] = static_cast<unsigned char>((value * 255 + maxValue / 2) / maxValue);
+			}
+
+			if(channels == 1) {
+				to[1] = to[0];
+				to[2] = to[0];
+			}
+
+			to[3] = 255;
+		}
+	}
+}
+
+// decode a PNG image (all color types, bit depths and interlacing are supported)
+void Image::decodePNG(const std::vector<unsigned char>& data) {
+	uint32_t w = 0;
+	uint32_t h = 0;
+	unsigned int depth = 0;
+	unsigned int colorType = 0;
+	unsigned int interlace = 0;
+	bool header = false;
+	bool end = false;
+
+	std::vector<unsigned char> compressed;
+	std::vector<unsigned char> palette;
+	std::vector<unsigned char> transparency;
+
+	// read the chunks
+	std::size_t pos = 8;
+
+	while(!end) {
+		if(pos + 12 > data.size())
+			throw std::runtime_error("Image::decodePNG(): truncated file");
+
+		const uint32_t length = Image::readBigEndian32(&data[pos]);
+
+		if(length > data.size() - pos - 12)
+			throw std::runtime_error("Image::decodePNG(): truncated file");
+
+		const unsigned char * type = &data[pos + 4];
+		const unsigned char * chunk = &data[pos + 8];
+
+		if(!std::memcmp(type, "IHDR", 4)) {
+			if(length < 13)
+				throw std::runtime_error("Image::decodePNG(): invalid header");
+
+			w = Image::readBigEndian32(chunk);
+			h = Image::readBigEndian32(chunk + 4);
+			depth = chunk[8];
+			colorType = chunk[9];
+			interlace = chunk[12];
+
+			if(chunk[10] || chunk[11] || interlace > 1)
+				throw std::runtime_error("Image::decodePNG(): unsupported compression, filter or interlace method");
+
+			header = true;
+		}
+		else if(!std::memcmp(type, "PLTE", 4))
+			palette.assign(chunk, chunk + length);
+		else if(!std::memcmp(type, "tRNS", 4))
+			transparency.assign(chunk, chunk + length);
+		else if(!std::memcmp(type, "IDAT", 4))
+			compressed.insert(compressed.end(), chunk, chunk + length);
+		else if(!std::memcmp(type, "IEND", 4))
+			end = true;
+		else if(!(type[0] & 0x20))
+			throw std::runtime_error(
+					"Image::decodePNG(): unsupported critical chunk '"
+					+ std::string(reinterpret_cast<const char *>(type), 4)
+					+ "'"
+			);
+
+		pos += length + 12;
+	}
+
+	if(!header)
+		throw std::runtime_error("Image::decodePNG(): missing header");
+
+	// check the color type and the bit depth
+	unsigned int channels = 0;
+
+	switch(colorType) {
+	case 0:
+		channels = 1;
+
+		if(depth != 1 && depth != 2 && depth != 4 && depth != 8 && depth != 16)
+			throw std::runtime_error("Image::decodePNG(): invalid bit depth");
+
+		break;
+
+	case 2:
+	case 4:
+	case 6:
+		channels = colorType == 2 ? 3 : colorType == 4 ? 2 : 4;
+
+		if(depth != 8 && depth != 16)
+			throw std::runtime_error("Image::decodePNG(): invalid bit depth");
+
+		break;
+
+	case 3:
+		channels = 1;
+
+		if(depth != 1 && depth != 2 && depth != 4 && depth != 8)
+			throw std::runtime_error("Image::decodePNG(): invalid bit depth");
+
+		if(palette.empty())
+			throw std::runtime_error("Image::decodePNG(): missing palette");
+
+		break;
+
+	default:
+		throw std::runtime_error("Image::decodePNG(): invalid color type");
+	}
+
+	this->create(w, h);
+
+	// get the passes (one without interlacing, seven with Adam7 interlacing)
+	struct Pass {
+		uint32_t x;
+		uint32_t y;
+		uint32_t stepX;
+		uint32_t stepY;
+	};
+
+	const std::vector<Pass> passes = interlace ? std::vector<Pass>{
+			{ 0, 0, 8, 8 }, { 4, 0, 8, 8 }, { 0, 4, 4, 8 }, { 2, 0, 4, 4 }, { 0, 2, 2, 4 }, { 1, 0, 2, 2 }, { 0, 1, 1, 2 }
+	} : std::vector<Pass>{ { 0, 0, 1, 1 } };
+
+	const std::size_t bitsPerPixel = channels * depth;
+	const std::size_t bytesPerPixel = std::max<std::size_t>(bitsPerPixel / 8, 1);
+	std::size_t size = 0;
+
+	for(const auto& pass : passes) {
+		const std::size_t passW = (w - pass.x + pass.stepX - 1) / pass.stepX;
+		const std::size_t passH = (h - pass.y + pass.stepY - 1) / pass.stepY;
+
+		if(w > pass.x && h > pass.y)
+			size += passH * (1 + (passW * bitsPerPixel + 7) / 8);
+	}
+
+	// decompress the image data
+	std::vector<unsigned char> raw(size);
+	uLongf rawSize = size;
+
+	if(
+			uncompress(raw.data(), &rawSize, compressed.data(), compressed.size()) != Z_OK
+			|| rawSize != size
+	)
+		throw std::runtime_error("Image::decodePNG(): invalid or truncated image data");
+
+	// read one sample (or palette index) of a row
+	const auto sample = [depth](const unsigned char * row, std::size_t index) -> unsigned int {
+		switch(depth) {
+		case 16:
+			return (row[index * 2] << 8) | row[index * 2 + 1];
+
+		case 8:
+			return row[index];
+
+		default: {
+			const std::size_t bit = index * depth;
+
+			return (row[bit / 8] >> (8 - depth - bit % 8)) & ((1 << depth) - 1);
+		}
+		}
+	};
+
+	// convert a sample to eight bits
+	const auto convert = [depth](unsigned int value) -> unsigned char {
+		if(depth == 16)
+			return value >> 8;
+
+		return value * 255 / ((1 << depth) - 1);
+	};
+
+	// get the color key for images without alpha channel
+	unsigned int keys[3] = { 0x10000, 0x10000, 0x10000 };
+
+	if(colorType == 0 && transparency.size() >= 2)
+		keys[0] = (transparency[0] << 8) | transparency[1];
+	else if(colorType == 2 && transparency.size() >= 6)
+		for(int n = 0; n < 3; ++n)
+			keys[n] = (transparency[n * 2] << 8) | transparency[n * 2 + 1];
+
+	std::size_t offset = 0;
+
+	for(const auto& pass : passes) {
+		if(w <= pass.x || h <= pass.y)
+			continue;
+
+		const std::size_t passW = (w - pass.x + pass.stepX - 1) / pass.stepX;
+		const std::size_t passH = (h - pass.y + pass.stepY - 1) / pass.stepY;
+		const std::size_t rowSize = (passW * bitsPerPixel + 7) / 8;
+		const std::vector<unsigned char> empty(rowSize, 0);
+		const unsigned char * previous = empty.data();
+
+		for(std::size_t passY = 0; passY < passH; ++passY) {
+			const unsigned int filter = raw[offset];
+			unsigned char * current = &raw[offset + 1];
+
+			// reverse the filter of the row
+			for(std::size_t i = 0; i < rowSize; ++i) {
+				const unsigned int left = i >= bytesPerPixel ? current[i - bytesPerPixel] : 0;
+				const unsigned int up = previous[i];
+				const unsigned int upLeft = i >= bytesPerPixel ? previous[i - bytesPerPixel] : 0;
+
+				switch(filter) {
+				case 0:
+					break;
+
+				case 1:
+					current[i] += left;
+
+					break;
+
+				case 2:
+					current[i] += up;
+
+					break;
+
+				case 3:
+					current[i] += (left + up) / 2;
+
+					break;
+
+				case 4: {
+					// Paeth predictor
+					const int p = static_cast<int>(left + up) - static_cast<int>(upLeft);
+					const int pLeft = p > static_cast<int>(left) ? p - left : left - p;
+					const int pUp = p > static_cast<int>(up) ? p - up : up - p;
+					const int pUpLeft = p > static_cast<int>(upLeft) ? p - upLeft : upLeft - p;
+
+					if(pLeft <= pUp && pLeft <= pUpLeft)
+						current[i] += left;
+					else if(pUp <= pUpLeft)
+						current[i] += up;
+					else
+						current[i] += upLeft;
+
+					break;
+				}
+
+				default:
+					throw std::runtime_error("Image::decodePNG(): invalid filter type");
+				}
+			}
+
+			// convert the row to RGBA
+			auto * to = this->row(pass.y + passY * pass.stepY);
+
+			for(std::size_t passX = 0; passX < passW; ++passX) {
+				auto * pixel = to + (pass.x + passX * pass.stepX) * 4;
+
+				switch(colorType) {
+				case 0: {
+					const auto gray = sample(current, passX);
+
+					pixel[0] = pixel[1] = pixel[2] = convert(gray);
+					pixel[3] = gray == keys[0] ? 0 : 255;
+
+					break;
+				}
+
+				case 2: {
+					bool isKey = true;
+
+					for(std::size_t channel = 0; channel < 3; ++channel) {
+						const auto value = sample(current, passX * 3 + channel);
+
+						pixel[channel] = convert(value);
+
+						isKey = isKey && value == keys[channel];
+					}
+
+					pixel[3] = isKey ? 0 : 255;
+
+					break;
+				}
+
+				case 3: {
+					const auto index = sample(current, passX);
+
+					if(index * 3 + 2 >= palette.size())
+						throw std::runtime_error("Image::decodePNG(): invalid palette index");
+
+					pixel[0] = palette[index * 3];
+					pixel[1] = palette[index * 3 + 1];
+					pixel[2] = palette[index * 3 + 2];
+					pixel[3] = index < transparency.size() ? transparency[index] : 255;
+
+					break;
+				}
+
+				case 4:
+					pixel[0] = pixel[1] = pixel[2] = convert(sample(current, passX * 2));
+					pixel[3] = convert(sample(current, passX * 2 + 1));
+
+					break;
+
+				case 6:
+					for(std::size_t channel = 0; channel < 4; ++channel)
+						pixel[channel] = convert(sample(current, passX * 4 + channel));
+
+					break;
+				}
+			}
+
+			previous = current;
+			offset += rowSize + 1;
+		}
+	}
+}
+
+// decode a QOI image (see https://qoiformat.org/qoi-specification.pdf)
+void Image::decodeQOI(const std::vector<unsigned char>& data) {
+	constexpr std::size_t headerSize = 14;
+	constexpr std::size_t endSize = 8;
+
+	if(data.size() < headerSize + endSize)
+		throw std::runtime_error("Image::decodeQOI(): truncated file");
+
+	if(data[12] != 3 && data[12] != 4)
+		throw std::runtime_error("Image::decodeQOI(): invalid number of channels");
+
+	this->create(Image::readBigEndian32(&data[4]), Image::readBigEndian32(&data[8]));
+
+	unsigned char index[64][4] = {};
+	unsigned char pixel[4] = { 0, 0, 0, 255 };
+	unsigned int run = 0;
+	std::size_t pos = headerSize;
+	const std::size_t end = data.size() - endSize;
+
+	const auto need = [&pos, end](std::size_t bytes) {
+		if(pos + bytes > end)
+			throw std::runtime_error("Image::decodeQOI(): truncated file");
+	};
+
+	for(int y = 0; y < this->pixels.getHeight(); ++y) {
+		auto * to = this->row(y);
+
+		for(int x = 0; x < this->pixels.getWidth(); ++x, to += 4) {
+			if(run)
+				--run;
+			else {
+				need(1);
+
+				const unsigned char op = data[pos++];
+
+				if(op == 0xfe) {
+					// QOI_OP_RGB
+					need(3);
+
+					std::memcpy(pixel, &data[pos], 3);
+
+					pos += 3;
+				}
+				else if(op == 0xff) {
+					// QOI_OP_RGBA
+					need(4);
+
+					std::memcpy(pixel, &data[pos], 4);
+
+					pos += 4;
+				}
+				else {
+					switch(op & 0xc0) {
+					case 0x00:
+						// QOI_OP_INDEX
+						std::memcpy(pixel, index[op], 4);
+
+						break;
+
+					case 0x40:
+						// QOI_OP_DIFF
+						pixel[0] += ((op >> 4) & 0x03) - 2;
+						pixel[1] += ((op >> 2) & 0x03) - 2;
+						pixel[2] += (op & 0x03) - 2;
+
+						break;
+
+					case 0x80: {
+						// QOI_OP_LUMA
+						need(1);
+
+						const unsigned char next = data[pos++];
+						const int diffGreen = (op & 0x3f) - 32;
+
+						pixel[0] += diffGreen - 8 + ((next >> 4) & 0x0f);
+						pixel[1] += diffGreen;
+						pixel[2] += diffGreen - 8 + (next & 0x0f);
+
+						break;
+					}
+
+					default:
+						// QOI_OP_RUN
+						run = op & 0x3f;
+					}
+				}
+
+				std::memcpy(index[(pixel[0] * 3 + pixel[1] * 5 + pixel[2] * 7 + pixel[3] * 11) % 64], pixel, 4);
+			}
+
+			std::memcpy(to, pixel, 4);
+		}
+	}
+}
+
+// allocate the pixels for an image of the specified width (w) and height (h)
+void Image::create(uint64_t w, uint64_t h) {
+	// limit the size of the image to 2^28 pixels (i.e. 1 GiB)
+	constexpr uint64_t maxPixels = 1 << 28;
+
+	if(!w || !h || w > maxPixels || h > maxPixels || w * h > maxPixels)
+		throw std::runtime_error(
+				"Image::create(): invalid image size ("
+				+ std::to_string(w)
+				+ "x"
+				+ std::to_string(h)
+				+ ")"
+		);
+
+	this->pixels.allocate(static_cast<int>(w), static_cast<int>(h), 4);
+
+	if(!(this->pixels))
+		throw std::runtime_error("Image::create(): could not allocate memory");
+}
+
+// get a row of the image, counted from the top (as stored in image files)
+unsigned char * Image::row(int y) {
+	return static_cast<unsigned char *>(this->pixels.get())
+			+ static_cast<std::size_t>(this->pixels.getHeight() - 1 - y) * this->pixels.getWidth() * 4;
+}
+
+// map the pixels from the specified cache file, return whether it is still valid
+bool Image::loadCache(const std::string& cacheFile, const CacheHeader& expected) {
+	const int fd = open(cacheFile.c_str(), O_RDONLY);
+
+	if(fd < 0)
+		return false;
+
+	struct stat cacheStatus;
+
+	if(fstat(fd, &cacheStatus) || static_cast<std::size_t>(cacheStatus.st_size) < sizeof(CacheHeader)) {
+		close(fd);
+
+		return false;
+	}
+
+	const std::size_t size = cacheStatus.st_size;
+
+	//	NOTE:	The mapping is private, i.e. changes to the pixels will not be written back into the file.
+	void * pointer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+	close(fd);
+
+	if(pointer == MAP_FAILED)
+		return false;
+
+	CacheHeader header;
+
+	std::memcpy(&header, pointer, sizeof header);
+
+	if(
+			header.magic != expected.magic
+			|| header.version != expected.version
+			|| header.fileSize != expected.fileSize
+			|| header.fileTime != expected.fileTime
+			|| header.nameHash != expected.nameHash
+			|| !header.width
+			|| !header.height
+			|| size != sizeof header + static_cast<std::size_t>(header.width) * header.height * 4
+	) {
+		munmap(pointer, size);
+
+		return false;
+	}
+
+	madvise(pointer, size, MADV_WILLNEED);
+
+	this->mapped = pointer;
+	this->mappedSize = size;
+
+	this->pixels.map(header.width, header.height, 4, static_cast<unsigned char *>(pointer) + sizeof header);
+
+	return true;
+}
+
+// write the decoded pixels into the specified cache file
+//	NOTE:	Errors will be ignored, as the cache is optional.
+void Image::saveCache(const std::string& cacheFile, const CacheHeader& header) const {
+	// write into a temporary file first, so that other processes never map an incomplete file
+	const std::string temporaryFile = cacheFile + "." + std::to_string(getpid());
+	const int fd = open(temporaryFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+	if(fd < 0)
+		return;
+
+	const unsigned char * pointers[] = {
+			reinterpret_cast<const unsigned char *>(&header),
+			static_cast<const unsigned char *>(this->pixels.get())
+	};
+
+	const std::size_t sizes[] = {
+			sizeof header,
+			static_cast<std::size_t>(this->pixels.getWidth()) * this->pixels.getHeight() * 4
+	};
+
+	bool success = true;
+
+	for(std::size_t n = 0; n < 2 && success; ++n) {
+		std::size_t written = 0;
+
+		while(written < sizes[n]) {
+			const auto result = write(fd, pointers[n] + written, sizes[n] - written);
+
+			if(result <= 0) {
+				success = false;
+
+				break;
+			}
+
+			written += result;
+		}
+	}
+
+	if(close(fd))
+		success = false;
+
+	if(!success || std::rename(temporaryFile.c_str(), cacheFile.c_str()))
+		unlink(temporaryFile.c_str());
+}
+
+// read an unsigned 32-bit integer in big endian (i.e. network byte order)
+uint32_t Image::readBigEndian32(const unsigned char * bytes) {
+	return (static_cast<uint32_t>(bytes[0]) << 24)
+			| (static_cast<uint32_t>(bytes[1]) << 16)
+			| (static_cast<uint32_t>(bytes[2]) << 8)
+			| bytes[3];
+}
+
+// hash a string (using 64-bit FNV-1a)
+uint64_t Image::hash(const std::string& string) {
+	uint64_t result = 0xcbf29ce484222325;
+
+	for(const auto c : string) {
+		result ^= static_cast<unsigned char>(c);
+		result *= 0x100000001b3;
+	}
+
+	return result;
+}
+
+// draw an image at the specified window position (x, y), optionally scaled by an integer factor and/or flipped
+//	NOTE:	The pixels will be copied including their alpha values, i.e. without being blended with the buffer.
+void Engine::blit(const Image& image, int x, int y, unsigned int scale, unsigned char flags) {
+	if(image)
+		this->window.blit(image.getPixels(), 0, 0, image.getWidth(), image.getHeight(), x, y, scale, flags);
+}
@@ -0,0 +1,102 @@
+/*
+ * Image.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef IMAGE_H_
+#define IMAGE_H_
+
+#pragma once
+
+#include <fcntl.h>		// open, O_CREAT, O_RDONLY, O_TRUNC, O_WRONLY
+#include <sys/mman.h>	// madvise, mmap, munmap, MADV_WILLNEED, MAP_FAILED, MAP_PRIVATE, PROT_READ, PROT_WRITE
+#include <sys/stat.h>	// fstat, mkdir, stat
+#include <unistd.h>		// close, getpid, unlink, write
+
+#include <zlib.h>		// uncompress, uLongf, Z_OK
+
+#include <algorithm>	// std::max
+#include <cstddef>		// std::size_t
+#include <cstdint>		// int64_t, uint32_t, uint64_t
+#include <cstdio>		// std::rename
+#include <cstring>		// std::memcmp, std::memcpy
+#include <fstream>		// std::ifstream
+#include <iterator>		// std::istreambuf_iterator
+#include <stdexcept>	// std::runtime_error
+#include <string>		// std::string, std::to_string
+#include <vector>		// std::vector
+
+#include "Pixels.h"
+
+// image loaded from a PPM (or PGM), PNG or QOI file into pixels that can be copied into the buffer or a layer
+//	NOTE:	Like the buffer, the pixels will be stored bottom-up in RGBA (i.e. the first row is the bottom of the image).
+//			If a cache directory is specified, the decoded pixels will be written into it and
+//			mapped directly into memory on the next start, unless the image file has changed.
+class Image {
+public:
+	enum Format {
+		FORMAT_UNKNOWN,
+		FORMAT_PPM,
+		FORMAT_PNG,
+		FORMAT_QOI
+	};
+
+	Image();
+	Image(const std::string& fileName, const std::string& cacheDirectory = "");
+	virtual ~Image();
+
+	void load(const std::string& fileName, const std::string& cacheDirectory = "");
+	void clear();
+
+	int getWidth() const;
+	int getHeight() const;
+	const Pixels& getPixels() const;
+	bool isCached() const;
+
+	operator bool() const;
+
+	Image(const Image&) = delete;
+	Image& operator=(const Image&) = delete;
+
+	static Format detect(const std::vector<unsigned char>& data);
+
+private:
+	// header of a cache file, followed by the decoded pixels
+	struct CacheHeader {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t width;
+		uint32_t height;
+		uint64_t fileSize;
+		int64_t fileTime;
+		uint64_t nameHash;
+		unsigned char padding[24];
+	};
+
+	static_assert(sizeof(CacheHeader) == 64, "Image::CacheHeader needs to be aligned to a cache line");
+
+	static constexpr uint32_t cacheMagic = 0x43584950;	// "PIXC"
+	static constexpr uint32_t cacheVersion = 1;
+
+	void decodePPM(const std::vector<unsigned char>& data);
+	void decodePNG(const std::vector<unsigned char>& data);
+	void decodeQOI(const std::vector<unsigned char>& data);
+
+	void create(uint64_t w, uint64_t h);
+	unsigned char * row(int y);
+
+	bool loadCache(const std::string& cacheFile, const CacheHeader& expected);
+	void saveCache(const std::string& cacheFile, const CacheHeader& header) const;
+
+	static uint32_t readBigEndian32(const unsigned char * bytes);
+	static uint64_t hash(const std::string& string);
+
+	Pixels pixels;
+
+	void * mapped;
+	std::size_t mappedSize;
+};
+
+#endif /* IMAGE_H_ */
@@ -0,0 +1,363 @@
+/*
+ * Instrumentation.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "Instrumentation.h"
+
+#ifdef PIXELS_INSTRUMENTATION
+
+thread_local Instrumentation::State Instrumentation::state{};
+std::atomic<Instrumentation::Site *> Instrumentation::sites{nullptr};
+const bool Instrumentation::initialized = Instrumentation::init();
+
+// constructor registering the site
+Instrumentation::Site::Site(const char * name, bool realTime)
+		: name(name),
+		  realTime(realTime),
+		  next(nullptr),
+		  calls(0),
+		  allocations(0),
+		  frees(0),
+		  locks(0),
+		  syscalls(0),
+		  maxAllocations(0),
+		  maxLocks(0),
+		  maxSyscalls(0),
+		  violations(0) {
+	this->next = Instrumentation::sites.load(std::memory_order_relaxed);
+
+	while(!(Instrumentation::sites.compare_exchange_weak(this->next, this, std::memory_order_release, std::memory_order_relaxed)));
+}
+
+// constructor entering the scope
+Instrumentation::Scope::Scope(Site& site)
+		: site(site), outer(Instrumentation::state.realTime), begin(Instrumentation::state.counts) {
+	if(site.realTime)
+		Instrumentation::state.realTime = &site;
+}
+
+// destructor leaving the scope and adding its counts to the site
+Instrumentation::Scope::~Scope() {
+	const Counts& end = Instrumentation::state.counts;
+	const uint64_t allocations = end.allocations - this->begin.allocations;
+	const uint64_t locks = end.locks - this->begin.locks;
+	const uint64_t syscalls = end.syscalls - this->begin.syscalls;
+
+	this->site.calls.fetch_add(1, std::memory_order_relaxed);
+	this->site.allocations.fetch_add(allocations, std::memory_order_relaxed);
+	this->site.frees.fetch_add(end.frees - this->begin.frees, std::memory_order_relaxed);
+	this->site.locks.fetch_add(locks, std::memory_order_relaxed);
+	this->site.syscalls.fetch_add(syscalls, std::memory_order_relaxed);
+
+	Instrumentation::updateMax(this->site.maxAllocations, allocations);
+	Instrumentation::updateMax(this->site.maxLocks, locks);
+	Instrumentation::updateMax(this->site.maxSyscalls, syscalls);
+
+	Instrumentation::state.realTime = this->outer;
+}
+
+// get the counts of the current thread
+Instrumentation::Counts Instrumentation::getThreadCounts() {
+	return Instrumentation::state.counts;
+}
+
+// print the counts of all sites and of the current thread to stderr
+void Instrumentation::report() {
+	Instrumentation::state.reporting = true;
+
+	for(Site * site = Instrumentation::sites.load(std::memory_order_acquire); site; site = site->next) {
+		const uint64_t calls = site->calls.load(std::memory_order_relaxed);
+
+		std::fprintf(
+				stderr,
+				"instrumentation: '%s'%s: %llu calls, %llu allocations (max. %llu per call), %llu frees,"
+				" %llu locks (max. %llu per call), %llu syscalls (max. %llu per call)",
+				site->name,
+				site->realTime ? " (real-time)" : "",
+				static_cast<unsigned long long>(calls),
+				static_cast<unsigned long long>(site->allocations.load(std::memory_order_relaxed)),
+				static_cast<unsigned long long>(site->maxAllocations.load(std::memory_order_relaxed)),
+				static_cast<unsigned long long>(site->frees.load(std::memory_order_relaxed)),
+				static_cast<unsigned long long>(site->locks.load(std::memory_order_relaxed)),
+				static_cast<unsigned long long>(site->maxLocks.load(std::memory_order_relaxed)),
+				static_cast<unsigned long long>(site->syscalls.load(std::memory_order_relaxed)),
+				static_cast<unsigned long long>(site->maxSyscalls.load(std::memory_order_relaxed))
+		);
+
+		if(site->realTime)
+			std::fprintf(
+					stderr,
+					", %llu violations",
+					static_cast<unsigned long long>(site->violations.load(std::memory_order_relaxed))
+			);
+
+		std::fprintf(stderr, "\n");
+	}
+
+	const Counts& counts = Instrumentation::state.counts;
+
+	std::fprintf(
+			stderr,
+			"instrumentation: main thread: %llu allocations, %llu frees, %llu locks, %llu syscalls\n",
+			static_cast<unsigned long long>(counts.allocations),
+			static_cast<unsigned long long>(counts.frees),
+			static_cast<unsigned long long>(counts.locks),
+			static_cast<unsigned long long>(counts.syscalls)
+	);
+
+	Instrumentation::state.reporting = false;
+}
+
+// count an allocation in the current thread
+void Instrumentation::onAllocation() {
+	++(Instrumentation::state.counts.allocations);
+
+	Instrumentation::flag("allocation");
+}
+
+// count a free in the current thread
+void Instrumentation::onFree() {
+	++(Instrumentation::state.counts.frees);
+}
+
+// count a lock in the current thread
+void Instrumentation::onLock() {
+	++(Instrumentation::state.counts.locks);
+
+	Instrumentation::flag("lock");
+}
+
+// count a blocking system call in the current thread
+void Instrumentation::onSyscall() {
+	++(Instrumentation::state.counts.syscalls);
+
+	Instrumentation::flag("blocking system call");
+}
+
+// initialize the instrumentation when the program starts
+bool Instrumentation::init() {
+	void * frames[1];
+
+	// the first stack trace might allocate memory (by loading libgcc)
+	Instrumentation::state.reporting = true;
+
+	backtrace(frames, 1);
+
+	Instrumentation::state.reporting = false;
+
+	std::atexit(Instrumentation::report);
+
+	return true;
+}
+
+// report a violation inside a real-time scope (if any) with a stack trace
+void Instrumentation::flag(const char * what) {
+	Site * site = Instrumentation::state.realTime;
+
+	if(!site || Instrumentation::state.reporting)
+		return;
+
+	if(site->violations.fetch_add(1, std::memory_order_relaxed) >= Instrumentation::maxReports)
+		return;
+
+	Instrumentation::state.reporting = true;
+
+	void * frames[Instrumentation::maxFrames];
+
+	std::fprintf(
+			stderr,
+			"instrumentation: %s inside real-time scope '%s' (thread %lu):\n",
+			what,
+			site->name,
+			static_cast<unsigned long>(pthread_self())
+	);
+
+	backtrace_symbols_fd(frames, backtrace(frames, Instrumentation::maxFrames), STDERR_FILENO);
+
+	Instrumentation::state.reporting = false;
+}
+
+// update the specified maximum
+void Instrumentation::updateMax(std::atomic<uint64_t>& max, uint64_t value) {
+	uint64_t old = max.load(std::memory_order_relaxed);
+
+	while(old < value && !(max.compare_exchange_weak(old, value, std::memory_order_relaxed)));
+}
+
+/*
+ * REPLACED ALLOCATION FUNCTIONS
+ */
+
+void * operator new(std::size_t size) {
+	Instrumentation::onAllocation();
+
+	void * result = std::malloc(size ? size : 1);
+
+	if(!result)
+		throw std::bad_alloc();
+
+	return result;
+}
+
+void * operator new[](std::size_t size) {
+	return ::operator new(size);
+}
+
+void * operator new(std::size_t size, const std::nothrow_t&) noexcept {
+	Instrumentation::onAllocation();
+
+	return std::malloc(size ? size : 1);
+}
+
+void * operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+	return ::operator new(size, tag);
+}
+
+// (aligned allocation functions only exist since C++17)
+#ifdef __cpp_aligned_new
+
+void * operator new(std::size_t size, std::align_val_t alignment) {
+	Instrumentation::onAllocation();
+
+	const std::size_t align = std::max(static_cast<std::size_t>(alignment), sizeof(void *));
+	void * result = nullptr;
+
+	if(posix_memalign(&result, align, size ? size : 1))
+		throw std::bad_alloc();
+
+	return result;
+}
+
+void * operator new[](std::size_t size, std::align_val_t alignment) {
+	return ::operator new(size, alignment);
+}
+
+#endif
+
+void operator delete(void * pointer) noexcept {
+	if(!pointer)
+		return;
+
+	Instrumentation::onFree();
+
+	std::free(pointer);
+}
+
+void operator delete[](void * pointer) noexcept {
+	::operator delete(pointer);
+}
+
+void operator delete(void * pointer, std::size_t) noexcept {
+	::operator delete(pointer);
+}
+
+void operator delete[](void * pointer, std::size_t) noexcept {
+	::operator delete(pointer);
+}
+
+#ifdef __cpp_aligned_new
+
+void operator delete(void * pointer, std::align_val_t) noexcept {
+	::operator delete(pointer);
+}
+
+void operator delete[](void * pointer, std::align_val_t) noexcept {
+	::operator delete(pointer);
+}
+
+void operator delete(void * pointer, std::size_t, std::align_val_t) noexcept {
+	::operator delete(pointer);
+}
+
+void operator delete[](void * pointer, std::size_t, std::align_val_t) noexcept {
+	::operator delete(pointer);
+}
+
+#endif
+
+/*
+ * INTERPOSED LOCKING FUNCTIONS AND BLOCKING SYSTEM CALLS
+ */
+
+extern "C" {
+
+int pthread_mutex_lock(pthread_mutex_t * mutex) {
+	static const auto next = Instrumentation::getNext<int (*)(pthread_mutex_t *)>("pthread_mutex_lock");
+
+	Instrumentation::onLock();
+
+	return next(mutex);
+}
+
+int pthread_rwlock_rdlock(pthread_rwlock_t * rwlock) {
+	static const auto next = Instrumentation::getNext<int (*)(pthread_rwlock_t *)>("pthread_rwlock_rdlock");
+
+	Instrumentation::onLock();
+
+	return next(rwlock);
+}
+
+int pthread_rwlock_wrlock(pthread_rwlock_t * rwlock) {
+	static const auto next = Instrumentation::getNext<int (*)(pthread_rwlock_t *)>("pthread_rwlock_wrlock");
+
+	Instrumentation::onLock();
+
+	return next(rwlock);
+}
+
+ssize_t read(int fd, void * buffer, size_t count) {
+	static const auto next = Instrumentation::getNext<ssize_t (*)(int, void *, size_t)>("read");
+
+	Instrumentation::onSyscall();
+
+	return next(fd, buffer, count);
+}
+
+ssize_t write(int fd, const void * buffer, size_t count) {
+	static const auto next = Instrumentation::getNext<ssize_t (*)(int, const void *, size_t)>("write");
+
+	Instrumentation::onSyscall();
+
+	return next(fd, buffer, count);
+}
+
+int poll(pollfd * fds, nfds_t n, int timeout) {
+	static const auto next = Instrumentation::getNext<int (*)(pollfd *, nfds_t, int)>("poll");
+
+	Instrumentation::onSyscall();
+
+	return next(fds, n, timeout);
+}
+
+int nanosleep(const timespec * duration, timespec * remaining) {
+	static const auto next = Instrumentation::getNext<int (*)(const timespec *, timespec *)>("nanosleep");
+
+	Instrumentation::onSyscall();
+
+	return next(duration, remaining);
+}
+
+int clock_nanosleep(clockid_t clock, int flags, const timespec * duration, timespec * remaining) {
+	static const auto next = Instrumentation::getNext<int (*)(clockid_t, int, const timespec *, timespec *)>(
+			"clock_nanosleep"
+	);
+
+	Instrumentation::onSyscall();
+
+	return next(clock, flags, duration, remaining);
+}
+
+int usleep(useconds_t duration) {
+	static const auto next = Instrumentation::getNext<int (*)(useconds_t)>("usleep");
+
+	Instrumentation::onSyscall();
+
+	return next(duration);
+}
+
+}
+
+#endif /* PIXELS_INSTRUMENTATION */
@@ -0,0 +1,125 @@
+/*
+ * Instrumentation.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef INSTRUMENTATION_H_
+#define INSTRUMENTATION_H_
+
+#pragma once
+
+// counting of allocations, frees, locks and blocking system calls per thread and per instrumented scope (e.g. a frame or a callback)
+//	NOTE:	The instrumentation is only available when building with PIXELS_INSTRUMENTATION defined (and linking against libdl),
+//			otherwise PIXELS_INSTRUMENT will do nothing at all.
+//			Any allocation, lock or blocking system call inside a real-time scope will be reported with a stack trace on stderr.
+#ifdef PIXELS_INSTRUMENTATION
+
+#include <dlfcn.h>		// dlsym, RTLD_NEXT
+#include <execinfo.h>	// backtrace, backtrace_symbols_fd
+#include <poll.h>		// nfds_t, pollfd
+#include <pthread.h>	// pthread_mutex_t, pthread_rwlock_t, pthread_self
+#include <time.h>		// clockid_t, timespec
+#include <unistd.h>		// ssize_t, useconds_t, STDERR_FILENO
+
+#include <algorithm>	// std::max
+#include <atomic>		// std::atomic, std::memory_order
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint64_t
+#include <cstdio>		// std::fprintf, stderr
+#include <cstdlib>		// posix_memalign, std::atexit, std::free, std::malloc
+#include <new>			// std::align_val_t, std::bad_alloc, std::nothrow_t
+
+class Instrumentation {
+public:
+	struct Counts {
+		uint64_t allocations;
+		uint64_t frees;
+		uint64_t locks;
+		uint64_t syscalls;
+	};
+
+	// instrumented part of the code (use PIXELS_INSTRUMENT to create one)
+	//	NOTE:	Sites need to be static, because they will be reported when the program exits.
+	class Site {
+		friend class Instrumentation;
+
+	public:
+		Site(const char * name, bool realTime);
+
+	private:
+		const char * name;
+		bool realTime;
+		Site * next;
+
+		std::atomic<uint64_t> calls;
+		std::atomic<uint64_t> allocations;
+		std::atomic<uint64_t> frees;
+		std::atomic<uint64_t> locks;
+		std::atomic<uint64_t> syscalls;
+		std::atomic<uint64_t> maxAllocations;
+		std::atomic<uint64_t> maxLocks;
+		std::atomic<uint64_t> maxSyscalls;
+		std::atomic<uint64_t> violations;
+	};
+
+	// one call of an instrumented part of the code
+	class Scope {
+	public:
+		Scope(Site& site);
+		virtual ~Scope();
+
+		Scope(const Scope&) = delete;
+		Scope& operator=(const Scope&) = delete;
+
+	private:
+		Site& site;
+		Site * outer;
+		Counts begin;
+	};
+
+	static constexpr uint64_t maxReports = 8;	// maximum number of stack traces reported per real-time site
+	static constexpr int maxFrames = 32;		// maximum depth of reported stack traces
+
+	static Counts getThreadCounts();
+	static void report();
+
+	static void onAllocation();
+	static void onFree();
+	static void onLock();
+	static void onSyscall();
+
+	// get the next (i.e. the original) definition of an interposed function
+	template<typename T> static T getNext(const char * name) {
+		return reinterpret_cast<T>(dlsym(RTLD_NEXT, name));
+	}
+
+private:
+	struct State {
+		Counts counts;
+		Site * realTime;
+		bool reporting;
+	};
+
+	static bool init();
+	static void flag(const char * what);
+	static void updateMax(std::atomic<uint64_t>& max, uint64_t value);
+
+	static thread_local State state;
+	static std::atomic<Site *> sites;
+	static const bool initialized;
+};
+
+// instrument the rest of the current block, reporting any allocation, lock or blocking system call if realTime is true
+#define PIXELS_INSTRUMENT(name, realTime) \
+	static Instrumentation::Site instrumentationSite(name, realTime); \
+	Instrumentation::Scope instrumentationScope(instrumentationSite)
+
+#else
+
+#define PIXELS_INSTRUMENT(name, realTime)
+
+#endif /* PIXELS_INSTRUMENTATION */
+
+#endif /* INSTRUMENTATION_H_ */
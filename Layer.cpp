@@ -0,0 +1,260 @@
+/*
+ * Layer.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "Layer.h"
+
+// constructors and destructor
+Layer::Layer() : Layer(BLEND_MODE_ALPHA) {}
+Layer::Layer(BlendMode mode) : blendMode(mode), visible(true), reset(true), tilesX(0), tilesY(0), anyDirty(false) {}
+Layer::~Layer() {}
+
+// resize the layer to the specified width (w) and height (h), clearing it if the size has changed
+void Layer::resize(int w, int h) {
+	if(this->pixels && w == this->pixels.getWidth() && h == this->pixels.getHeight())
+		return;
+
+	this->pixels.deallocate();
+
+	this->tilesX = 0;
+	this->tilesY = 0;
+
+	this->dirty.clear();
+
+	if(w > 0 && h > 0) {
+		this->pixels.allocate(w, h, 4, Memory::HUGE_PAGES_NONE);
+
+		this->tilesX = (w + Layer::tileSize - 1) / Layer::tileSize;
+		this->tilesY = (h + Layer::tileSize - 1) / Layer::tileSize;
+	}
+
+	this->clear();
+
+	this->reset = true;
+}
+
+// set how the layer will be blended with the layers below
+void Layer::setBlendMode(BlendMode mode) {
+	if(mode != this->blendMode) {
+		this->blendMode = mode;
+
+		this->markAllDirty();
+	}
+}
+
+// set whether the layer is visible
+void Layer::setVisible(bool visible) {
+	if(visible != this->visible) {
+		this->visible = visible;
+
+		this->markAllDirty();
+	}
+}
+
+// clear the whole layer (i.e. make it transparent)
+void Layer::clear() {
+	if(this->pixels)
+		this->pixels.fill(0, 0, 0, 0);
+
+	this->markAllDirty();
+}
+
+// set one pixel (x, y) of the layer to the specified color (r, g, b, a)
+void Layer::set(int x, int y, unsigned char r, unsigned char g, unsigned char b, unsigned char a) {
+	if(x < 0 || y < 0 || x >= this->getWidth() || y >= this->getHeight())
+		return;
+
+	this->pixels.set(x, y, r, g, b, a);
+
+	this->markDirty(x, y, x + 1, y + 1);
+}
+
+// fill the pixels between the specified positions (x1, y1 and x2, y2) with the specified color (r, g, b, a)
+void Layer::fill(int x1, int y1, int x2, int y2, unsigned char r, unsigned char g, unsigned char b, unsigned char a) {
+	x1 = std::max(x1, 0);
+	y1 = std::max(y1, 0);
+	x2 = std::min(x2, this->getWidth());
+	y2 = std::min(y2, this->getHeight());
+
+	if(x1 >= x2 || y1 >= y2)
+		return;
+
+	const uint32_t color = Pixels::pack(r, g, b, a);
+	auto * data = static_cast<uint32_t *>(this->pixels.get());
+
+	for(int y = y1; y < y2; ++y)
+		std::fill_n(data + static_cast<std::size_t>(y) * this->getWidth() + x1, x2 - x1, color);
+
+	this->markDirty(x1, y1, x2, y2);
+}
+
+// write a row of n packed colors (see Pixels::pack) starting at the specified position (x, y) into the layer
+void Layer::putRow(int x, int y, const uint32_t * row, int n) {
+	if(y < 0 || y >= this->getHeight())
+		return;
+
+	if(x < 0) {
+		row -= x;
+		n += x;
+		x = 0;
+	}
+
+	if(x + n > this->getWidth())
+		n = this->getWidth() - x;
+
+	if(n <= 0)
+		return;
+
+	auto * data = static_cast<uint32_t *>(this->pixels.get());
+
+	std::memcpy(data + static_cast<std::size_t>(y) * this->getWidth() + x, row, n * sizeof *row);
+
+	this->markDirty(x, y, x + n, y + 1);
+}
+
+// copy a rectangle (sourceX, sourceY, w, h) of the specified pixels to the specified position (x, y) in the layer
+//	NOTE:	See Pixels::blit for the options.
+void Layer::blit(
+		const Pixels& source,
+		int sourceX,
+		int sourceY,
+		int w,
+		int h,
+		int x,
+		int y,
+		unsigned int scale,
+		unsigned char flags,
+		uint32_t colorKey
+) {
+	if(!(this->pixels))
+		return;
+
+	this->pixels.blit(source, sourceX, sourceY, w, h, x, y, scale, flags, colorKey);
+
+	this->markDirty(x, y, x + w * static_cast<int>(scale), y + h * static_cast<int>(scale));
+}
+
+// mark the tiles between the specified positions (x1, y1 and x2, y2) as changed
+void Layer::markDirty(int x1, int y1, int x2, int y2) {
+	x1 = std::max(x1, 0);
+	y1 = std::max(y1, 0);
+	x2 = std::min(x2, this->getWidth());
+	y2 = std::min(y2, this->getHeight());
+
+	if(x1 >= x2 || y1 >= y2)
+		return;
+
+	const int tileX2 = (x2 - 1) / Layer::tileSize;
+	const int tileY2 = (y2 - 1) / Layer::tileSize;
+
+	for(int tileY = y1 / Layer::tileSize; tileY <= tileY2; ++tileY)
+		for(int tileX = x1 / Layer::tileSize; tileX <= tileX2; ++tileX)
+			this->dirty[tileY * this->tilesX + tileX] = 1;
+
+	this->anyDirty = true;
+}
+
+// mark the whole layer as changed
+void Layer::markAllDirty() {
+	this->dirty.assign(static_cast<std::size_t>(this->tilesX) * this->tilesY, 1);
+
+	this->anyDirty = true;
+}
+
+// mark the whole layer as unchanged (after it has been composited)
+void Layer::clean() {
+	if(this->anyDirty)
+		std::fill(this->dirty.begin(), this->dirty.end(), 0);
+
+	this->anyDirty = false;
+	this->reset = false;
+}
+
+// get the width of the layer
+int Layer::getWidth() const {
+	return this->pixels.getWidth();
+}
+
+// get the height of the layer
+int Layer::getHeight() const {
+	return this->pixels.getHeight();
+}
+
+// get how the layer will be blended with the layers below
+Layer::BlendMode Layer::getBlendMode() const {
+	return this->blendMode;
+}
+
+// get whether the layer is visible
+bool Layer::isVisible() const {
+	return this->visible;
+}
+
+// get whether the layer has been cleared by resizing since it has been composited for the last time
+bool Layer::isReset() const {
+	return this->reset;
+}
+
+// get whether any tile of the layer has changed
+bool Layer::isDirty() const {
+	return this->anyDirty;
+}
+
+// get whether the specified tile of the layer has changed
+bool Layer::isDirty(int tileX, int tileY) const {
+	return this->dirty[tileY * this->tilesX + tileX];
+}
+
+// blend n pixels starting at the specified position (x, y) of the layer onto the specified row (in RGBA)
+//	NOTE:	The row will be blended channel by channel, so that the compiler can vectorize the loops.
+void Layer::blendRow(int x, int y, int n, unsigned char * to) const {
+	const auto * from = static_cast<const unsigned char *>(this->pixels.get())
+			+ (static_cast<std::size_t>(y) * this->getWidth() + x) * 4;
+	const int count = n * 4;
+
+	// divide by 255 with rounding (exact for all products of two bytes)
+	const auto div255 = [](unsigned int value) {
+		value += 128;
+
+		return (value + (value >> 8)) >> 8;
+	};
+
+	switch(this->blendMode) {
+	case BLEND_MODE_REPLACE:
+		for(int i = 0; i < count; ++i)
+			if((i & 3) != 3)
+				to[i] = from[i];
+
+		break;
+
+	case BLEND_MODE_ALPHA:
+		for(int i = 0; i < count; ++i) {
+			const unsigned int a = from[i | 3];
+
+			to[i] = div255(from[i] * a + to[i] * (255 - a));
+		}
+
+		break;
+
+	case BLEND_MODE_ADD:
+		for(int i = 0; i < count; ++i) {
+			const unsigned int sum = to[i] + div255(from[i] * from[i | 3]);
+
+			to[i] = sum > 255 ? 255 : sum;
+		}
+
+		break;
+
+	case BLEND_MODE_MULTIPLY:
+		for(int i = 0; i < count; ++i) {
+			const unsigned int a = from[i | 3];
+
+			to[i] = div255(to[i] * (div255(from[i] * a) + 255 - a));
+		}
+
+		break;
+	}
+}
@@ -0,0 +1,90 @@
+/*
+ * Layer.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef LAYER_H_
+#define LAYER_H_
+
+#pragma once
+
+#include <algorithm>	// std::fill, std::fill_n, std::max, std::min
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint32_t
+#include <cstring>		// std::memcpy
+#include <vector>		// std::vector
+
+#include "Pixels.h"
+
+// retained layer of pixels that will be composited by the main window, keeping track of the tiles that have changed
+//	NOTE:	All coordinates are in logical pixels (i.e. independent of the pixel size of the window).
+//			The layer will be resized (and cleared) automatically by the main window,
+//			use Layer::isReset to check whether its content needs to be re-drawn.
+class Layer {
+public:
+	// size of the tiles (in logical pixels) that are tracked for changes
+	static constexpr int tileSize = 32;
+
+	enum BlendMode {
+		BLEND_MODE_REPLACE,		// replace the color of the layers below (alpha is ignored)
+		BLEND_MODE_ALPHA,		// blend over the layers below using the alpha of the layer
+		BLEND_MODE_ADD,			// add to the color of the layers below (weighted by alpha)
+		BLEND_MODE_MULTIPLY		// multiply with the color of the layers below (weighted by alpha)
+	};
+
+	Layer();
+	Layer(BlendMode mode);
+	virtual ~Layer();
+
+	void resize(int w, int h);
+
+	void setBlendMode(BlendMode mode);
+	void setVisible(bool visible);
+
+	void clear();
+	void set(int x, int y, unsigned char r, unsigned char g, unsigned char b, unsigned char a = 255);
+	void fill(int x1, int y1, int x2, int y2, unsigned char r, unsigned char g, unsigned char b, unsigned char a = 255);
+	void putRow(int x, int y, const uint32_t * row, int n);
+	void blit(
+			const Pixels& source,
+			int sourceX,
+			int sourceY,
+			int w,
+			int h,
+			int x,
+			int y,
+			unsigned int scale = 1,
+			unsigned char flags = Pixels::BLIT_NONE,
+			uint32_t colorKey = 0
+	);
+
+	void markDirty(int x1, int y1, int x2, int y2);
+	void markAllDirty();
+	void clean();
+
+	int getWidth() const;
+	int getHeight() const;
+	BlendMode getBlendMode() const;
+	bool isVisible() const;
+	bool isReset() const;
+	bool isDirty() const;
+	bool isDirty(int tileX, int tileY) const;
+
+	void blendRow(int x, int y, int n, unsigned char * to) const;
+
+private:
+	Pixels pixels;
+
+	BlendMode blendMode;
+	bool visible;
+	bool reset;
+
+	int tilesX;
+	int tilesY;
+	std::vector<unsigned char> dirty;
+	bool anyDirty;
+};
+
+#endif /* LAYER_H_ */
@@ -14,19 +14,39 @@ MainWindow::MainWindow()
 		  renderingMode(RENDERING_MODE_PBO),
 		  pboId(0),
 		  textureId(0),
+		  mappedForReading(false),
+		  keyedBlits(false),
 		  width(0),
 		  height(0),
 		  bytes(4),
 		  pixelWidth(0),
 		  pixelHeight(0),
 		  clearBuffer(false),
+		  hugePages(Memory::HUGE_PAGES_TRANSPARENT),
 		  pixelSize(1),
 		  halfPixelSize(0),
 		  rendering(false),
 		  lastTime(0.),
 		  elapsedTime(0.),
 		  fps(0.),
-		  debugChanged(false) {
+		  debugChanged(false),
+		  postProcess(nullptr),
+		  recorder(nullptr),
+		  replayer(nullptr),
+		  replaying(false),
+		  sharedFrames(nullptr),
+		  metricFrameTime(nullptr),
+		  metricFrames(nullptr),
+		  metricUploadBytes(nullptr),
+		  metricFPS(nullptr),
+		  interlacing(INTERLACING_NONE),
+		  reconstruction(RECONSTRUCTION_PREVIOUS),
+		  field(0),
+		  historySize(0),
+		  tilesX(0),
+		  tilesY(0),
+		  layersComposed(false),
+		  frameChanged(true) {
 	for(int n = 0; n < GLFW_KEY_LAST; ++n) {
 		keys[n].pressed = false;
 		keys[n].held = false;
@@ -102,6 +122,24 @@ void MainWindow::init(unsigned int w, unsigned int h, const std::string& title)
 
 // tick in window loop to process window events, return whether window has been closed
 bool MainWindow::update() {
+	PIXELS_INSTRUMENT("MainWindow::update", false);
+
+	if(!(this->beginFrame()))
+		return false;
+
+	// update frame (unless a recording is being replayed)
+	if(!(this->replaying))
+		this->onUpdate(this->getElapsedTime());
+
+	this->endFrame();
+
+	return true;
+}
+
+// process window events and start rendering a new frame, return false if the window has been closed
+//	NOTE:	Use MainWindow::update instead, unless the frame is updated without a callback (see StaticEngine).
+//			Unless MainWindow::isReplaying returns true, the frame needs to be drawn before calling MainWindow::endFrame.
+bool MainWindow::beginFrame() {
 	// check whether window has been closed
 	if(glfwWindowShouldClose(this->windowPointer))
 		return false;
@@ -127,8 +165,38 @@ bool MainWindow::update() {
 	// begin rendering to pixel buffer
 	this->beginRendering();
 
-	// update frame
-	this->onUpdate(this->getElapsedTime());
+	this->replaying = this->replayer && this->renderingMode != RENDERING_MODE_POINTS;
+
+	if(this->replaying)
+		// show the next frame of the recording instead of updating the frame
+		this->replay();
+
+	return true;
+}
+
+// finish rendering the current frame and show it
+void MainWindow::endFrame() {
+	if(!(this->replaying)) {
+		// composite the layers if this has not been done before drawing onto them
+		if(!(this->layersComposed))
+			this->composeLayers();
+
+		// apply post-processing to the pixel buffer if necessary
+		if(this->postProcess && this->renderingMode != RENDERING_MODE_POINTS) {
+			this->postProcess->apply(this->pixels);
+
+			if(*(this->postProcess)) {
+				// the whole buffer has been changed, i.e. all layers need to be composited again
+				std::fill(this->damage.begin(), this->damage.end(), 1);
+
+				this->frameChanged = true;
+			}
+		}
+	}
+
+	// record the finished frame if necessary
+	if(this->recorder && this->renderingMode != RENDERING_MODE_POINTS)
+		this->recorder->record(this->pixels, this->getTime());
 
 	// end rendering to pixel buffer
 	this->endRendering();
@@ -147,7 +215,17 @@ bool MainWindow::update() {
 	this->lastTime = currentTime;
 	this->fps = 1. / this->elapsedTime;
 
-	return true;
+	// update the metrics if necessary
+	if(this->metricFrames) {
+		this->metricFrameTime->observe(this->elapsedTime);
+		this->metricFrames->add();
+		this->metricFPS->set(this->fps);
+	}
+}
+
+// close the window after the current frame, i.e. MainWindow::update will return false afterwards
+void MainWindow::close() {
+	glfwSetWindowShouldClose(this->windowPointer, GLFW_TRUE);
 }
 
 // get the width of the framebuffer in pixels
@@ -181,6 +259,44 @@ MainWindow::RenderingMode MainWindow::getRenderingMode() const {
 	return this->renderingMode;
 }
 
+// get whether a recording is being replayed in the current frame (i.e. the frame does not need to be drawn)
+bool MainWindow::isReplaying() const {
+	return this->replaying;
+}
+
+// get the pixel buffer of the current frame
+//	NOTE:	The buffer is only valid while rendering a frame and not available when drawing OpenGL points.
+//			Drawing into it directly bypasses the pixel test and the layers.
+Pixels& MainWindow::getBuffer() {
+	return this->pixels;
+}
+
+// get one of the previous frames, starting with the last one (age 1) up to the size of the history
+//	NOTE:	The frames are in physical pixels (i.e. not scaled to the pixel size) and
+//			will be black until enough frames have been rendered. They are not available when drawing OpenGL points.
+const Pixels& MainWindow::getHistory(unsigned int age) const {
+	if(!age || age > this->history.size())
+		throw std::runtime_error("MainWindow::getHistory(): frame #" + std::to_string(age) + " is not in the history");
+
+	return *(this->history[age - 1]);
+}
+
+// get the number of previous frames kept in the history
+unsigned int MainWindow::getHistorySize() const {
+	return this->historySize;
+}
+
+// get which pixels are rendered every frame
+MainWindow::Interlacing MainWindow::getInterlacing() const {
+	return this->interlacing;
+}
+
+// get the field to be rendered in the current frame (0 or 1),
+//	i.e. rows where (y & 1) equals the field or pixels where ((x + y) & 1) equals the field, depending on the interlacing
+unsigned char MainWindow::getField() const {
+	return this->field;
+}
+
 // check whether the specified key has been pressed this frame
 bool MainWindow::isKeyPressed(unsigned int code) const {
 	if(code <= 0 || code > GLFW_KEY_LAST)
@@ -214,9 +330,18 @@ bool MainWindow::isKeyRepeated(unsigned int code) const {
 }
 
 // set the rendering mode
+//	NOTE:	If the window has not been created yet, the rendering mode will be used when it is created.
 void MainWindow::setRenderingMode(RenderingMode mode) {
-	// end rendering if necessary
-	if(this->rendering)
+	if(!(this->windowPointer)) {
+		this->renderingMode = mode;
+
+		return;
+	}
+
+	// end rendering if necessary (remembering whether to start again afterwards)
+	const bool wasRendering = this->rendering;
+
+	if(wasRendering)
 		this->endRendering();
 
 	// destroy old rendering target
@@ -228,7 +353,7 @@ void MainWindow::setRenderingMode(RenderingMode mode) {
 	this->initRenderingTarget();
 
 	// start rendering if necessary
-	if(this->rendering)
+	if(wasRendering)
 		this->beginRendering();
 }
 
@@ -237,6 +362,12 @@ void MainWindow::setClearBuffer(bool clear) {
 	this->clearBuffer = clear;
 }
 
+// set whether and how to use huge pages for the pixel buffer in system memory (default: transparent huge pages)
+//	NOTE:	Will be used the next time the rendering target is initialized, i.e. it should be set before the window is created.
+void MainWindow::setHugePages(Memory::HugePages hugePages) {
+	this->hugePages = hugePages;
+}
+
 // set the actual size of one pixel
 void MainWindow::setPixelSize(unsigned short size) {
 	this->pixelSize = size;
@@ -261,6 +392,140 @@ void MainWindow::setPixelTest(const PixelTest& test) {
 		this->pixelTest.init(this->pixelWidth, this->pixelHeight);
 }
 
+// set whether to render only half of the pixels every frame and how to reconstruct the other half
+//	NOTE:	Interlacing only applies to rendering fields (see MainWindow::getFieldRow and MainWindow::putField),
+//			e.g. by using Engine::shade, while anything else will still be drawn directly.
+void MainWindow::setInterlacing(Interlacing interlacing, Reconstruction reconstruction) {
+	this->interlacing = interlacing;
+	this->reconstruction = reconstruction;
+
+	this->resetInterlacing();
+}
+
+// set the number of previous frames to keep (0 to keep none)
+//	NOTE:	The history is not available when drawing OpenGL points.
+//			When using a texture, the frames will be rotated without copying, unless the buffer is not cleared
+//			(or layers are used) in which case the last frame needs to be copied into the buffer for the new frame.
+//			The pixel buffer object needs to be read and copied while keeping a history,
+//			use the texture rendering mode for better performance.
+void MainWindow::setHistory(unsigned int frames) {
+	this->historySize = frames;
+
+	this->resetHistory();
+}
+
+// set the filters to be applied to the pixel buffer after every frame (nullptr to disable post-processing)
+//	NOTE:	Post-processing is not available when drawing OpenGL points.
+//			The filters are applied to the buffer itself, i.e. they will accumulate
+//			over multiple frames if the buffer is not cleared or completely overdrawn.
+void MainWindow::setPostProcess(PostProcess * postProcess) {
+	this->postProcess = postProcess;
+}
+
+// add a layer on top of all other layers to be composited into the buffer
+//	NOTE:	Layers are not available when drawing OpenGL points. While layers are used,
+//			the buffer will not be cleared, but anything drawn onto the layers directly
+//			(i.e. not into a layer) will be removed again in the next frame.
+void MainWindow::addLayer(Layer * layer) {
+	if(!layer)
+		throw std::runtime_error("MainWindow::addLayer(): no layer specified");
+
+	if(std::find(this->layers.begin(), this->layers.end(), layer) != this->layers.end())
+		return;
+
+	this->layers.push_back(layer);
+
+	this->resetLayers();
+}
+
+// remove a layer from the layers to be composited into the buffer
+void MainWindow::removeLayer(Layer * layer) {
+	const auto it = std::find(this->layers.begin(), this->layers.end(), layer);
+
+	if(it == this->layers.end())
+		return;
+
+	this->layers.erase(it);
+
+	this->resetLayers();
+
+	this->frameChanged = true;
+}
+
+// set the recorder to write every finished frame into (nullptr to stop recording)
+//	NOTE:	Recording is not available when drawing OpenGL points.
+//			The pixel buffer object needs to be read while recording, use the texture rendering mode for better performance.
+void MainWindow::setRecorder(Recorder * recorder) {
+	this->recorder = recorder;
+}
+
+// set the replayer to show the frames of a recording instead of updating the frames (nullptr to stop replaying)
+//	NOTE:	Replaying is not available when drawing OpenGL points.
+//			After the last frame of the recording, it will continue to be shown.
+void MainWindow::setReplayer(Replayer * replayer) {
+	this->replayer = replayer;
+
+	// all layers need to be composited again afterwards
+	std::fill(this->damage.begin(), this->damage.end(), 1);
+}
+
+// set the ring in shared memory to export every finished frame into (nullptr to stop exporting)
+//	NOTE:	Exporting frames is not available when drawing OpenGL points.
+//			When using a texture, the pixel buffer will be located in the shared memory itself, i.e. without additional copying,
+//			unless the buffer is not cleared (see MainWindow::setClearBuffer), in which case the last frame will be copied into the next slot.
+//			The pixel buffer object needs to be read while exporting, use the texture rendering mode for better performance.
+void MainWindow::setSharedFrames(SharedFrames * sharedFrames) {
+	if(!(this->windowPointer) || this->renderingMode != RENDERING_MODE_TEXTURE) {
+		this->sharedFrames = sharedFrames;
+
+		return;
+	}
+
+	// re-initialize the texture, because its pixel buffer will be moved
+	const bool wasRendering = this->rendering;
+
+	if(wasRendering)
+		this->endRendering();
+
+	this->destroyRenderingTarget();
+
+	this->sharedFrames = sharedFrames;
+
+	this->initRenderingTarget();
+
+	if(wasRendering)
+		this->beginRendering();
+}
+
+// add the metrics of the window (i.e. frame times, frames, uploaded bytes and framerate) to the registry (nullptr to stop)
+void MainWindow::setMetrics(Metrics * metrics) {
+	if(!metrics) {
+		this->metricFrameTime = nullptr;
+		this->metricFrames = nullptr;
+		this->metricUploadBytes = nullptr;
+		this->metricFPS = nullptr;
+
+		return;
+	}
+
+	this->metricFrameTime = &(metrics->addHistogram(
+			"pixels_frame_seconds",
+			"Duration of a frame in seconds."
+	));
+	this->metricFrames = &(metrics->addCounter(
+			"pixels_frames_total",
+			"Number of frames shown."
+	));
+	this->metricUploadBytes = &(metrics->addCounter(
+			"pixels_upload_bytes_total",
+			"Number of bytes uploaded to textures."
+	));
+	this->metricFPS = &(metrics->addGauge(
+			"pixels_fps",
+			"Current framerate in frames per second."
+	));
+}
+
 // write one pixel into the buffer / draw it onto the screen
 void MainWindow::putPixel(
 		unsigned int x,
@@ -288,6 +553,9 @@ void MainWindow::putPixel(
 		glVertex2i(x * this->pixelSize + this->halfPixelSize, y * this->pixelSize + this->halfPixelSize);
 	}
 	else {
+		if(!(this->layers.empty()))
+			this->drawOverLayers(x, y, x + 1, y + 1);
+
 		int limitX = this->pixelSize;
 		int limitY = this->pixelSize;
 
@@ -314,6 +582,205 @@ void MainWindow::putPixel(
 	}
 }
 
+// write a row of n packed colors (see Pixels::pack) starting at the specified position (x, y) into the buffer
+//	NOTE:	The row will be expanded to the pixel size and copied directly into the buffer, except for drawing OpenGL points
+//			or when a pixel test is set, in which case every pixel will be put separately.
+void MainWindow::putRow(int x, int y, const uint32_t * row, int n) {
+	// clip the row
+	if(y < 0 || y >= this->pixelHeight)
+		return;
+
+	if(x < 0) {
+		row -= x;
+		n += x;
+		x = 0;
+	}
+
+	if(x + n > this->pixelWidth)
+		n = this->pixelWidth - x;
+
+	if(n <= 0)
+		return;
+
+	if(this->renderingMode == RENDERING_MODE_POINTS || this->pixelTest) {
+		for(int relX = 0; relX < n; ++relX) {
+			unsigned char color[4];
+
+			std::memcpy(color, row + relX, sizeof color);
+
+			this->putPixel(x + relX, y, color[0], color[1], color[2], color[3]);
+		}
+
+		return;
+	}
+
+	if(!(this->layers.empty()))
+		this->drawOverLayers(x, y, x + n, y + 1);
+
+	this->writeRow(x, y, row, n);
+}
+
+// get the specified row of the frame to render the pixels of the current field into (see MainWindow::getField)
+//	NOTE:	The row contains all pixels of the last frame, but only the pixels of the current field should be overwritten.
+uint32_t * MainWindow::getFieldRow(int y) {
+	return this->fields.data() + static_cast<std::size_t>(y) * this->pixelWidth;
+}
+
+// reconstruct the pixels that are not part of the current field and put the whole frame into the buffer
+void MainWindow::putField() {
+	if(this->interlacing == INTERLACING_NONE || this->fields.empty())
+		return;
+
+	const int w = this->pixelWidth;
+	const int h = this->pixelHeight;
+
+	if(this->reconstruction == RECONSTRUCTION_INTERPOLATE)
+		switch(this->interlacing) {
+		case INTERLACING_ROWS:
+			// interpolate the missing rows between the rows above and below
+			for(int y = this->field ^ 1; y < h; y += 2) {
+				if(h == 1)
+					break;
+
+				const uint32_t * below = this->getFieldRow(y > 0 ? y - 1 : y + 1);
+				const uint32_t * above = this->getFieldRow(y + 1 < h ? y + 1 : y - 1);
+				uint32_t * out = this->getFieldRow(y);
+
+				for(int x = 0; x < w; ++x)
+					out[x] = Pixels::average(below[x], above[x]);
+			}
+
+			break;
+
+		case INTERLACING_CHECKERBOARD:
+			// interpolate the missing pixels between their horizontal and vertical neighbours
+			for(int y = 0; y < h; ++y) {
+				const uint32_t * below = y > 0 ? this->getFieldRow(y - 1) : nullptr;
+				const uint32_t * above = y + 1 < h ? this->getFieldRow(y + 1) : nullptr;
+				uint32_t * out = this->getFieldRow(y);
+
+				for(int x = (y + this->field + 1) & 1; x < w; x += 2) {
+					uint32_t horizontal = out[x];
+
+					if(x > 0 && x + 1 < w)
+						horizontal = Pixels::average(out[x - 1], out[x + 1]);
+					else if(x > 0)
+						horizontal = out[x - 1];
+					else if(x + 1 < w)
+						horizontal = out[x + 1];
+
+					uint32_t vertical = horizontal;
+
+					if(below && above)
+						vertical = Pixels::average(below[x], above[x]);
+					else if(below)
+						vertical = below[x];
+					else if(above)
+						vertical = above[x];
+
+					out[x] = Pixels::average(horizontal, vertical);
+				}
+			}
+
+			break;
+
+		default:
+			break;
+		}
+
+	for(int y = 0; y < h; ++y)
+		this->putRow(0, y, this->getFieldRow(y), w);
+}
+
+// copy a rectangle (sourceX, sourceY, w, h) of the specified pixels to the specified position (x, y) in the buffer
+//	NOTE:	Whole rows will be copied directly into the buffer, except for drawing OpenGL points
+//			or when a pixel test is set, in which case every pixel will be put separately.
+void MainWindow::blit(
+		const Pixels& source,
+		int sourceX,
+		int sourceY,
+		int w,
+		int h,
+		int x,
+		int y,
+		unsigned int scale,
+		unsigned char flags,
+		uint32_t colorKey
+) {
+	// the color key needs the destination pixels to be read, i.e. re-map the pixel buffer object if necessary
+	if((flags & Pixels::BLIT_COLOR_KEY) && !(this->keyedBlits)) {
+		this->keyedBlits = true;
+
+		if(this->renderingMode == RENDERING_MODE_PBO && this->rendering && !(this->mappedForReading)) {
+			glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+
+			this->pixels.unmap();
+
+			this->mapBuffer();
+		}
+	}
+
+	if(this->renderingMode != RENDERING_MODE_POINTS && !(this->pixelTest)) {
+		if(!(this->layers.empty()))
+			this->drawOverLayers(x, y, x + w * static_cast<int>(scale), y + h * static_cast<int>(scale));
+
+		this->pixels.blit(
+				source,
+				sourceX,
+				sourceY,
+				w,
+				h,
+				x * this->pixelSize,
+				y * this->pixelSize,
+				scale * this->pixelSize,
+				flags,
+				colorKey
+		);
+
+		return;
+	}
+
+	if(sourceX < 0 || sourceY < 0 || sourceX + w > source.getWidth() || sourceY + h > source.getHeight())
+		throw std::runtime_error("MainWindow::blit(): source rectangle out of bounds");
+
+	if(source.getBytes() != 4)
+		throw std::runtime_error("MainWindow::blit(): only four bytes per pixel are supported");
+
+	// put every (scaled) pixel separately
+	const auto * sourcePixels = static_cast<const unsigned char *>(source.get());
+	const int s = static_cast<int>(scale);
+
+	for(int relY = 0; relY < h * s; ++relY) {
+		const int putY = y + relY;
+
+		if(putY < 0 || putY >= this->pixelHeight)
+			continue;
+
+		const int rowY = sourceY + ((flags & Pixels::BLIT_FLIP_Y) ? h - 1 - relY / s : relY / s);
+
+		for(int relX = 0; relX < w * s; ++relX) {
+			const int putX = x + relX;
+
+			if(putX < 0 || putX >= this->pixelWidth)
+				continue;
+
+			const int columnX = sourceX + ((flags & Pixels::BLIT_FLIP_X) ? w - 1 - relX / s : relX / s);
+			const auto * color = sourcePixels + (static_cast<std::size_t>(rowY) * source.getWidth() + columnX) * 4;
+
+			if(flags & Pixels::BLIT_COLOR_KEY) {
+				uint32_t value = 0;
+
+				std::memcpy(&value, color, sizeof value);
+
+				if((value & Pixels::pack(255, 255, 255, 0)) == (colorKey & Pixels::pack(255, 255, 255, 0)))
+					continue;
+			}
+
+			this->putPixel(putX, putY, color[0], color[1], color[2], color[3]);
+		}
+	}
+}
+
 // set callback function for updating the content
 void MainWindow::setOnUpdate(UpdateFunction callBack) {
 	this->onUpdate = callBack;
@@ -354,6 +821,10 @@ void MainWindow::setProjection() {
 	// set model
 	glMatrixMode(GL_MODELVIEW);
 	glLoadIdentity();
+
+	// resize the layers and the interlaced frame if necessary
+	this->resetLayers();
+	this->resetInterlacing();
 }
 
 // reset keys (only pressed and released)
@@ -370,6 +841,235 @@ void MainWindow::clearKeys() {
 	}
 }
 
+// check whether the content of the pixel buffer will be read while rendering (i.e. not only written)
+//	NOTE:	After the first blit with a color key, the buffer will always be mapped for reading, too.
+bool MainWindow::isReadingBuffer() const {
+	return (this->postProcess && *(this->postProcess))
+			|| this->recorder
+			|| this->sharedFrames
+			|| this->historySize
+			|| this->keyedBlits;
+}
+
+// map the memory of the (bound) pixel buffer object (for reading, too, if necessary)
+void MainWindow::mapBuffer() {
+	this->mappedForReading = this->isReadingBuffer();
+
+	this->pixels.map(
+			this->width,
+			this->height,
+			this->bytes,
+			static_cast<unsigned char *>(
+					glMapBuffer(GL_PIXEL_UNPACK_BUFFER, this->mappedForReading ? GL_READ_WRITE : GL_WRITE_ONLY)
+			)
+	);
+
+	if(!(this->pixels))
+		throw std::runtime_error("Could not map memory of pixel buffer object");
+}
+
+// write a (clipped) row of n packed colors starting at the specified position (x, y) into the buffer, expanding it to the pixel size
+void MainWindow::writeRow(int x, int y, const uint32_t * row, int n) {
+	// write the first physical row
+	const int offsetX = x * this->pixelSize;
+	const int offsetY = y * this->pixelSize;
+	const int count = std::min(n * this->pixelSize, this->width - offsetX);
+	const int limitY = std::min(static_cast<int>(this->pixelSize), this->height - offsetY);
+
+	auto * first = static_cast<uint32_t *>(this->pixels.get()) + static_cast<std::size_t>(offsetY) * this->width + offsetX;
+
+	if(this->pixelSize == 1)
+		std::memcpy(first, row, count * sizeof *first);
+	else {
+		auto * to = first;
+		int left = count;
+
+		for(int relX = 0; left > 0; ++relX) {
+			const int repeat = std::min(static_cast<int>(this->pixelSize), left);
+
+			std::fill_n(to, repeat, row[relX]);
+
+			to += repeat;
+			left -= repeat;
+		}
+	}
+
+	// copy it to the other physical rows covered by the pixel
+	for(int relY = 1; relY < limitY; ++relY)
+		std::memcpy(first + static_cast<std::size_t>(relY) * this->width, first, count * sizeof *first);
+}
+
+// copy the next frame of the recording into the buffer (if there is one)
+//	NOTE:	After the recording has ended, its last frame will be copied again if the buffer has been cleared.
+void MainWindow::replay() {
+	if(!(this->replayer->next()) && !(this->clearBuffer && this->layers.empty() && this->replayer->getFrame()))
+		return;
+
+	const auto& frame = this->replayer->getFrame();
+
+	if(frame.getWidth() != this->width || frame.getHeight() != this->height)
+		this->pixels.fill(0, 0, 0, 255);
+
+	this->pixels.blit(
+			frame,
+			0,
+			0,
+			std::min(frame.getWidth(), this->width),
+			std::min(frame.getHeight(), this->height),
+			0,
+			0
+	);
+
+	std::fill(this->damage.begin(), this->damage.end(), 1);
+
+	this->frameChanged = true;
+}
+
+// reset the layers and the damaged tiles after the size of the buffer or the rendering target has changed
+void MainWindow::resetLayers() {
+	this->tilesX = (this->pixelWidth + Layer::tileSize - 1) / Layer::tileSize;
+	this->tilesY = (this->pixelHeight + Layer::tileSize - 1) / Layer::tileSize;
+
+	this->damage.assign(static_cast<std::size_t>(this->tilesX) * this->tilesY, 1);
+
+	for(auto * layer : this->layers)
+		layer->resize(this->pixelWidth, this->pixelHeight);
+
+	this->layersComposed = false;
+}
+
+// (re-)allocate the frame for interlacing if necessary, starting with black
+void MainWindow::resetInterlacing() {
+	if(this->interlacing == INTERLACING_NONE) {
+		this->fields.clear();
+		this->fields.shrink_to_fit();
+	}
+	else
+		this->fields.assign(static_cast<std::size_t>(this->pixelWidth) * this->pixelHeight, Pixels::pack(0, 0, 0));
+}
+
+// (re-)allocate the previous frames if necessary, starting with black frames
+void MainWindow::resetHistory() {
+	this->history.clear();
+
+	if(!(this->windowPointer) || this->renderingMode == RENDERING_MODE_POINTS)
+		return;
+
+	for(unsigned int n = 0; n < this->historySize; ++n) {
+		this->history.emplace_back(std::make_unique<Pixels>());
+
+		this->history.back()->allocate(this->width, this->height, this->bytes, this->hugePages);
+	}
+}
+
+// add the current frame to the history, dropping the oldest frame
+void MainWindow::pushHistory() {
+	if(this->history.empty() || !(this->pixels))
+		return;
+
+	auto& oldest = *(this->history.back());
+
+	if(this->renderingMode == RENDERING_MODE_TEXTURE && !(this->sharedFrames))
+		// use the buffer of the oldest frame for the next frame
+		this->pixels.swap(oldest);
+	else
+		std::memcpy(oldest.get(), this->pixels.get(), static_cast<std::size_t>(this->width) * this->height * this->bytes);
+
+	std::rotate(this->history.begin(), this->history.end() - 1, this->history.end());
+}
+
+// composite the tiles of all layers that have been changed or drawn over into the buffer
+void MainWindow::composeLayers() {
+	this->layersComposed = true;
+
+	if(this->layers.empty() || this->renderingMode == RENDERING_MODE_POINTS)
+		return;
+
+	// add the changed tiles of the layers to the damaged tiles
+	for(const auto * layer : this->layers)
+		if(layer->isDirty())
+			for(int tileY = 0; tileY < this->tilesY; ++tileY)
+				for(int tileX = 0; tileX < this->tilesX; ++tileX)
+					if(layer->isDirty(tileX, tileY))
+						this->damage[tileY * this->tilesX + tileX] = 1;
+
+	if(this->composed.size() < static_cast<std::size_t>(this->pixelWidth))
+		this->composed.resize(this->pixelWidth);
+
+	auto * row = this->composed.data();
+
+	for(int tileY = 0; tileY < this->tilesY; ++tileY) {
+		int tileX = 0;
+
+		while(tileX < this->tilesX) {
+			if(!(this->damage[tileY * this->tilesX + tileX])) {
+				++tileX;
+
+				continue;
+			}
+
+			// composite consecutive damaged tiles at once
+			int tileX2 = tileX + 1;
+
+			while(tileX2 < this->tilesX && this->damage[tileY * this->tilesX + tileX2])
+				++tileX2;
+
+			const int x1 = tileX * Layer::tileSize;
+			const int x2 = std::min(tileX2 * Layer::tileSize, this->pixelWidth);
+			const int y1 = tileY * Layer::tileSize;
+			const int y2 = std::min(y1 + Layer::tileSize, this->pixelHeight);
+			const int n = x2 - x1;
+
+			for(int y = y1; y < y2; ++y) {
+				std::fill_n(row, n, Pixels::pack(0, 0, 0));
+
+				for(const auto * layer : this->layers)
+					if(layer->isVisible())
+						layer->blendRow(x1, y, n, reinterpret_cast<unsigned char *>(row));
+
+				// the buffer itself needs to be opaque
+				for(int relX = 0; relX < n; ++relX)
+					row[relX] |= Pixels::pack(0, 0, 0, 255);
+
+				this->writeRow(x1, y, row, n);
+			}
+
+			this->frameChanged = true;
+
+			tileX = tileX2;
+		}
+	}
+
+	std::fill(this->damage.begin(), this->damage.end(), 0);
+
+	for(auto * layer : this->layers)
+		layer->clean();
+}
+
+// composite the layers if necessary before drawing directly into the buffer,
+//	and mark the tiles between the specified positions (x1, y1 and x2, y2) for being composited again in the next frame
+void MainWindow::drawOverLayers(int x1, int y1, int x2, int y2) {
+	if(!(this->layersComposed))
+		this->composeLayers();
+
+	x1 = std::max(x1, 0);
+	y1 = std::max(y1, 0);
+	x2 = std::min(x2, this->pixelWidth);
+	y2 = std::min(y2, this->pixelHeight);
+
+	if(x1 >= x2 || y1 >= y2)
+		return;
+
+	const int tileX2 = (x2 - 1) / Layer::tileSize;
+	const int tileY2 = (y2 - 1) / Layer::tileSize;
+
+	for(int tileY = y1 / Layer::tileSize; tileY <= tileY2; ++tileY)
+		for(int tileX = x1 / Layer::tileSize; tileX <= tileX2; ++tileX)
+			this->damage[tileY * this->tilesX + tileX] = 1;
+
+	this->frameChanged = true;
+}
+
 // initialize rendering target
 void MainWindow::initRenderingTarget() {
 	// destroy old rendering target if necessary
@@ -379,6 +1079,12 @@ void MainWindow::initRenderingTarget() {
 	if(this->pixelTest)
 		this->pixelTest.init(this->pixelWidth, this->pixelHeight);
 
+	// all layers need to be composited into the new rendering target
+	this->resetLayers();
+
+	// the previous frames need to be re-allocated for the new rendering target
+	this->resetHistory();
+
 	switch(this->renderingMode) {
 	case RENDERING_MODE_PBO:
 		// generate pixel buffer object
@@ -487,8 +1193,11 @@ void MainWindow::initRenderingTarget() {
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
 		glTexEnvf(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_DECAL);
 
-		// allocate memory for rendering data
-		this->pixels.allocate(this->width, this->height, this->bytes);
+		// allocate memory for rendering data (or use the shared memory, see beginRendering)
+		if(this->sharedFrames)
+			this->sharedFrames->create(this->width, this->height);
+		else
+			this->pixels.allocate(this->width, this->height, this->bytes, this->hugePages);
 
 		break;
 	}
@@ -501,25 +1210,20 @@ void MainWindow::beginRendering() {
 		this->pixelTest.frame();
 
 	this->rendering = true;
+	this->layersComposed = false;
+	this->field ^= 1;
+	this->frameChanged = this->layers.empty();
 
 	switch(this->renderingMode) {
 	case RENDERING_MODE_PBO:
 		// bind pixel buffer object
 		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, this->pboId);
 
-		// map memory of pixel buffer object
-		this->pixels.map(
-				this->width,
-				this->height,
-				this->bytes,
-				static_cast<unsigned char *>(glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY))
-		);
+		// map memory of pixel buffer object (for reading, too, if necessary)
+		this->mapBuffer();
 
-		if(!(this->pixels))
-			throw std::runtime_error("Could not map memory of pixel buffer object");
-
-		// clear the pixel buffer object if necessary
-		if(this->clearBuffer)
+		// clear the pixel buffer object if necessary (and no layers are used)
+		if(this->clearBuffer && this->layers.empty())
 			this->pixels.fill(0, 0, 0, 255);
 
 		break;
@@ -534,9 +1238,24 @@ void MainWindow::beginRendering() {
 		break;
 
 	case RENDERING_MODE_TEXTURE:
-		// clear the texture if necessary
-		if(this->clearBuffer)
+		// use the next slot in the shared memory if necessary (keeping the last frame if the buffer is not cleared)
+		if(this->sharedFrames)
+			this->pixels.map(
+					this->width,
+					this->height,
+					this->bytes,
+					this->sharedFrames->begin(!(this->clearBuffer && this->layers.empty()))
+			);
+
+		// clear the texture if necessary (and no layers are used), or restore the last frame after rotating the history
+		if(this->clearBuffer && this->layers.empty())
 			this->pixels.fill(0, 0, 0, 255);
+		else if(!(this->history.empty()) && !(this->sharedFrames))
+			std::memcpy(
+					this->pixels.get(),
+					this->history.front()->get(),
+					static_cast<std::size_t>(this->width) * this->height * this->bytes
+			);
 
 		break;
 	}
@@ -565,6 +1284,12 @@ void MainWindow::renderQuad() {
 void MainWindow::endRendering() {
 	switch(this->renderingMode) {
 	case RENDERING_MODE_PBO:
+		// export the frame and add it to the history if necessary
+		if(this->sharedFrames)
+			this->sharedFrames->write(this->pixels, this->getTime());
+
+		this->pushHistory();
+
 		// unmap memory of pixel buffer object
 		glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
 
@@ -572,9 +1297,15 @@ void MainWindow::endRendering() {
 
 		//glDrawPixels(this->width, this->height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
 
-		// bind and update texture
+		// bind and update texture (if the frame has changed)
 		glBindTexture (GL_TEXTURE_2D, this->textureId);
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->width, this->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, this->pixels.get());
+
+		if(this->frameChanged) {
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->width, this->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, this->pixels.get());
+
+			if(this->metricUploadBytes)
+				this->metricUploadBytes->add(static_cast<uint64_t>(this->width) * this->height * this->bytes);
+		}
 
 		glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 
@@ -592,12 +1323,27 @@ void MainWindow::endRendering() {
 		break;
 
 	case RENDERING_MODE_TEXTURE:
-		// update texture
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->width, this->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, this->pixels.get());
+		// update texture (if the frame has changed)
+		if(this->frameChanged) {
+			glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->width, this->height, 0, GL_RGBA, GL_UNSIGNED_BYTE, this->pixels.get());
+
+			if(this->metricUploadBytes)
+				this->metricUploadBytes->add(static_cast<uint64_t>(this->width) * this->height * this->bytes);
+		}
 
 		// render textured quad
 		this->renderQuad();
 
+		// add the frame to the history if necessary
+		this->pushHistory();
+
+		// publish the frame in the shared memory if necessary
+		if(this->sharedFrames) {
+			this->sharedFrames->end(this->getTime());
+
+			this->pixels.unmap();
+		}
+
 		break;
 	}
 
@@ -14,15 +14,27 @@
 
 #include <GLFW/glfw3.h>
 
+#include <algorithm>	// std::fill, std::fill_n, std::find, std::max, std::min, std::rotate
 #include <chrono>		// std::chrono
 #include <cstddef>		// std::size_t
+#include <cstdint>		// uint32_t
+#include <cstring>		// std::memcpy
 #include <functional>	// std::function, std::placeholders
+#include <memory>		// std::make_unique, std::unique_ptr
 #include <stdexcept>	// std::runtime_error
 #include <string>		// std::string, std::to_string
-#include <vector>
+#include <vector>		// std::vector
 
+#include "Instrumentation.h"
+#include "Layer.h"
+#include "Memory.h"
+#include "Metrics.h"
 #include "Pixels.h"
 #include "PixelTest.h"
+#include "PostProcess.h"
+#include "Recorder.h"
+#include "Replayer.h"
+#include "SharedFrames.h"
 
 #define UNUSED(x) (void)(x)
 
@@ -37,11 +49,27 @@ public:
 		RENDERING_MODE_TEXTURE
 	};
 
+	// pixels to be rendered every frame (see MainWindow::getFieldRow)
+	enum Interlacing {
+		INTERLACING_NONE,			// render all pixels
+		INTERLACING_ROWS,			// render every second row, alternating every frame
+		INTERLACING_CHECKERBOARD	// render every second pixel in a checkerboard pattern, alternating every frame
+	};
+
+	// reconstruction of the pixels that have not been rendered in the current frame
+	enum Reconstruction {
+		RECONSTRUCTION_PREVIOUS,	// keep the pixels of the previous frame
+		RECONSTRUCTION_INTERPOLATE	// interpolate the neighbouring pixels of the current frame
+	};
+
 	MainWindow();
 	virtual ~MainWindow();
 
 	void init(unsigned int w, unsigned int h, const std::string& title);
 	bool update();
+	bool beginFrame();
+	void endFrame();
+	void close();
 
 	int getWidth() const;
 	int getHeight() const;
@@ -49,6 +77,12 @@ public:
 	double getElapsedTime() const;
 	double getFPS() const;
 	RenderingMode getRenderingMode() const;
+	bool isReplaying() const;
+	Pixels& getBuffer();
+	const Pixels& getHistory(unsigned int age) const;
+	unsigned int getHistorySize() const;
+	Interlacing getInterlacing() const;
+	unsigned char getField() const;
 
 	bool isKeyPressed(unsigned int code) const;
 	bool isKeyHeld(unsigned int code) const;
@@ -57,8 +91,18 @@ public:
 
 	void setRenderingMode(RenderingMode mode);
 	void setClearBuffer(bool clear);
+	void setHugePages(Memory::HugePages hugePages);
 	void setPixelSize(unsigned short size);
 	void setPixelTest(const PixelTest& test);
+	void setInterlacing(Interlacing interlacing, Reconstruction reconstruction = RECONSTRUCTION_PREVIOUS);
+	void setHistory(unsigned int frames);
+	void setPostProcess(PostProcess * postProcess);
+	void addLayer(Layer * layer);
+	void removeLayer(Layer * layer);
+	void setRecorder(Recorder * recorder);
+	void setReplayer(Replayer * replayer);
+	void setSharedFrames(SharedFrames * sharedFrames);
+	void setMetrics(Metrics * metrics);
 	void putPixel(
 			unsigned int x,
 			unsigned int y,
@@ -68,6 +112,21 @@ public:
 			unsigned char a = 255,
 			bool test = true
 	);
+	void putRow(int x, int y, const uint32_t * row, int n);
+	uint32_t * getFieldRow(int y);
+	void putField();
+	void blit(
+			const Pixels& source,
+			int sourceX,
+			int sourceY,
+			int w,
+			int h,
+			int x,
+			int y,
+			unsigned int scale = 1,
+			unsigned char flags = Pixels::BLIT_NONE,
+			uint32_t colorKey = 0
+	);
 
 	void setOnUpdate(UpdateFunction callBack);
 	void setOnResize(ResizeFunction callBack);
@@ -78,6 +137,17 @@ public:
 private:
 	void setProjection();
 	void clearKeys();
+	bool isReadingBuffer() const;
+	void mapBuffer();
+	void writeRow(int x, int y, const uint32_t * row, int n);
+	void replay();
+	void resetInterlacing();
+	void resetHistory();
+	void pushHistory();
+
+	void resetLayers();
+	void composeLayers();
+	void drawOverLayers(int x1, int y1, int x2, int y2);
 
 	void initRenderingTarget();
 	void beginRendering();
@@ -100,6 +170,8 @@ private:
 	unsigned int pboId;
 	unsigned int textureId;
 	Pixels pixels;
+	bool mappedForReading;
+	bool keyedBlits;
 
 	std::string title;
 	int width;
@@ -108,6 +180,7 @@ private:
 	int pixelWidth;
 	int pixelHeight;
 	bool clearBuffer;
+	Memory::HugePages hugePages;
 	unsigned short pixelSize;
 	unsigned short halfPixelSize;
 
@@ -129,6 +202,32 @@ private:
 	ResizeFunction onResize;
 
 	PixelTest pixelTest;
+	PostProcess * postProcess;
+	Recorder * recorder;
+	Replayer * replayer;
+	bool replaying;
+	SharedFrames * sharedFrames;
+
+	Metrics::Histogram * metricFrameTime;
+	Metrics::Counter * metricFrames;
+	Metrics::Counter * metricUploadBytes;
+	Metrics::Gauge * metricFPS;
+
+	Interlacing interlacing;
+	Reconstruction reconstruction;
+	unsigned char field;
+	std::vector<uint32_t, Memory::Allocator<uint32_t>> fields;
+
+	unsigned int historySize;
+	std::vector<std::unique_ptr<Pixels>> history;
+
+	std::vector<Layer *> layers;
+	std::vector<unsigned char> damage;
+	std::vector<uint32_t, Memory::Allocator<uint32_t>> composed;
+	int tilesX;
+	int tilesY;
+	bool layersComposed;
+	bool frameChanged;
 };
 
 #endif /* MAINWINDOW_H_ */
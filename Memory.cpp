@@ -0,0 +1,86 @@
+/*
+ * Memory.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "Memory.h"
+
+namespace Memory {
+	// round the size of a directly mapped buffer up to whole huge pages
+	//	NOTE:	Explicit huge pages can only be unmapped in whole, so the rounding
+	//			needs to be the same when allocating and deallocating a buffer.
+	static std::size_t mappedSize(std::size_t size) {
+		return (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+	}
+
+	// touch every page of the buffer, so that the kernel backs it with physical memory now instead of on first use
+	static void touch(void * pointer, std::size_t size) {
+		static const std::size_t pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+		volatile unsigned char * bytes = static_cast<unsigned char *>(pointer);
+
+		for(std::size_t offset = 0; offset < size; offset += pageSize)
+			bytes[offset] = 0;
+	}
+
+	// allocate a buffer of the specified size aligned to (at least) Memory::alignment bytes
+	//	NOTE:	Buffers with a size of at least Memory::hugePageSize will be mapped directly and,
+	//			depending on the specified option, backed by huge pages if the system supports it.
+	//			The buffer needs to be deallocated using Memory::deallocate with the same size !
+	void * allocate(std::size_t size, HugePages hugePages, bool prefault) {
+		if(!size)
+			return nullptr;
+
+		void * result = nullptr;
+
+		if(size < hugePageSize) {
+			// use aligned heap memory for smaller buffers
+			if(posix_memalign(&result, alignment, size))
+				throw std::bad_alloc();
+		}
+		else {
+			const auto fullSize = mappedSize(size);
+
+#ifdef MAP_HUGETLB
+			// try to use explicit huge pages if requested (will fail if none have been reserved)
+			if(hugePages == HUGE_PAGES_EXPLICIT) {
+				result = mmap(nullptr, fullSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+				if(result == MAP_FAILED)
+					result = nullptr;
+			}
+#endif
+
+			if(!result) {
+				result = mmap(nullptr, fullSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+				if(result == MAP_FAILED)
+					throw std::bad_alloc();
+
+#ifdef MADV_HUGEPAGE
+				// advise the kernel to use transparent huge pages (needs to happen BEFORE the memory is touched)
+				if(hugePages != HUGE_PAGES_NONE)
+					madvise(result, fullSize, MADV_HUGEPAGE);
+#endif
+			}
+		}
+
+		if(prefault)
+			touch(result, size);
+
+		return result;
+	}
+
+	// deallocate a buffer that has been allocated by Memory::allocate with the specified size
+	void deallocate(void * pointer, std::size_t size) {
+		if(!pointer)
+			return;
+
+		if(size < hugePageSize)
+			std::free(pointer);
+		else
+			munmap(pointer, mappedSize(size));
+	}
+}
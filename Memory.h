@@ -0,0 +1,63 @@
+/*
+ * Memory.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef MEMORY_H_
+#define MEMORY_H_
+
+#pragma once
+
+#include <sys/mman.h>	// madvise, mmap, munmap, MADV_HUGEPAGE, MAP_ANONYMOUS, MAP_FAILED, MAP_HUGETLB, MAP_PRIVATE, PROT_READ, PROT_WRITE
+#include <unistd.h>		// sysconf, _SC_PAGESIZE
+
+#include <cstddef>		// std::size_t
+#include <cstdlib>		// std::free, posix_memalign
+#include <limits>		// std::numeric_limits
+#include <new>			// std::bad_alloc
+
+namespace Memory {
+	// alignment of all buffers (i.e. the size of a cache line)
+	constexpr std::size_t alignment = 64;
+
+	// size of one (transparent or explicit) huge page, buffers of at least this size will be mapped directly
+	constexpr std::size_t hugePageSize = 2 * 1024 * 1024;
+
+	// whether and how to use huge pages for large buffers
+	enum HugePages {
+		HUGE_PAGES_NONE,			// use normal pages only
+		HUGE_PAGES_TRANSPARENT,		// advise the kernel to use transparent huge pages (default)
+		HUGE_PAGES_EXPLICIT			// try to use explicit (i.e. reserved) huge pages first
+	};
+
+	void * allocate(std::size_t size, HugePages hugePages = HUGE_PAGES_TRANSPARENT, bool prefault = true);
+	void deallocate(void * pointer, std::size_t size);
+
+	// allocator for standard containers holding large buffers (e.g. audio data)
+	//	NOTE:	Memory will not be pre-faulted, because the container will initialize its elements anyway.
+	template<typename T>
+	struct Allocator {
+		using value_type = T;
+
+		Allocator() noexcept {}
+		template<typename U> Allocator(const Allocator<U>&) noexcept {}
+
+		T * allocate(std::size_t n) {
+			if(n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+				throw std::bad_alloc();
+
+			return static_cast<T *>(Memory::allocate(n * sizeof(T), HUGE_PAGES_TRANSPARENT, false));
+		}
+
+		void deallocate(T * pointer, std::size_t n) noexcept {
+			Memory::deallocate(pointer, n * sizeof(T));
+		}
+
+		template<typename U> bool operator==(const Allocator<U>&) const noexcept { return true; }
+		template<typename U> bool operator!=(const Allocator<U>&) const noexcept { return false; }
+	};
+}
+
+#endif /* MEMORY_H_ */
@@ -0,0 +1,423 @@
+/*
+ * Metrics.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "Metrics.h"
+
+// default bounds for histograms of durations, from 0.1ms to 100ms (in seconds)
+const std::vector<double> Metrics::defaultTimeBounds{
+	0.0001, 0.00025, 0.0005, 0.001, 0.0025, 0.005, 0.01, 0.0167, 0.025, 0.05, 0.1
+};
+
+// constructor of a histogram with the specified (ascending) upper bounds of its buckets
+Metrics::Histogram::Histogram(const std::vector<double>& bounds)
+		: bounds(bounds),
+		  buckets(std::make_unique<std::atomic<uint64_t>[]>(bounds.size() + 1)),
+		  count(0),
+		  sumBits(Metrics::toBits(0.)) {
+	for(std::size_t n = 0; n <= bounds.size(); ++n)
+		this->buckets[n].store(0, std::memory_order_relaxed);
+}
+
+// add a value to the histogram
+void Metrics::Histogram::observe(double value) {
+	std::size_t bucket = 0;
+
+	while(bucket < this->bounds.size() && value > this->bounds[bucket])
+		++bucket;
+
+	this->buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+	this->count.fetch_add(1, std::memory_order_relaxed);
+
+	uint64_t oldBits = this->sumBits.load(std::memory_order_relaxed);
+
+	while(
+			!(this->sumBits.compare_exchange_weak(
+					oldBits,
+					Metrics::toBits(Metrics::fromBits(oldBits) + value),
+					std::memory_order_relaxed
+			))
+	);
+}
+
+// get the upper bounds of the buckets
+const std::vector<double>& Metrics::Histogram::getBounds() const {
+	return this->bounds;
+}
+
+// get the number of values in the specified bucket (not cumulative, the last bucket has no upper bound)
+uint64_t Metrics::Histogram::getBucket(std::size_t index) const {
+	return this->buckets[index].load(std::memory_order_relaxed);
+}
+
+// get the number of values
+uint64_t Metrics::Histogram::getCount() const {
+	return this->count.load(std::memory_order_relaxed);
+}
+
+// get the sum of all values
+double Metrics::Histogram::getSum() const {
+	return Metrics::fromBits(this->sumBits.load(std::memory_order_relaxed));
+}
+
+// constructor and destructor
+Metrics::Metrics() : running(false), socketFd(-1), interval(0.) {}
+
+Metrics::~Metrics() {
+	this->stop();
+}
+
+// add a counter with the specified name and description
+//	NOTE:	If a counter with the same name has already been added, it will be returned instead.
+Metrics::Counter& Metrics::addCounter(const std::string& name, const std::string& help) {
+	std::lock_guard<std::mutex> guard(this->lock);
+
+	const auto * existing = this->find(name, TYPE_COUNTER);
+
+	if(existing)
+		return *(existing->counter);
+
+	auto entry = std::make_unique<Entry>();
+
+	entry->name = name;
+	entry->help = help;
+	entry->type = TYPE_COUNTER;
+	entry->counter = std::make_unique<Counter>();
+
+	auto& result = *(entry->counter);
+
+	this->entries.emplace_back(std::move(entry));
+
+	return result;
+}
+
+// add a gauge with the specified name and description
+//	NOTE:	If a gauge with the same name has already been added, it will be returned instead.
+Metrics::Gauge& Metrics::addGauge(const std::string& name, const std::string& help) {
+	std::lock_guard<std::mutex> guard(this->lock);
+
+	const auto * existing = this->find(name, TYPE_GAUGE);
+
+	if(existing)
+		return *(existing->gauge);
+
+	auto entry = std::make_unique<Entry>();
+
+	entry->name = name;
+	entry->help = help;
+	entry->type = TYPE_GAUGE;
+	entry->gauge = std::make_unique<Gauge>();
+
+	auto& result = *(entry->gauge);
+
+	this->entries.emplace_back(std::move(entry));
+
+	return result;
+}
+
+// add a histogram with the specified name, description and upper bounds of its buckets
+//	NOTE:	If a histogram with the same name and bounds has already been added, it will be returned instead.
+Metrics::Histogram& Metrics::addHistogram(
+		const std::string& name,
+		const std::string& help,
+		const std::vector<double>& bounds
+) {
+	for(std::size_t n = 1; n < bounds.size(); ++n)
+		if(bounds[n] <= bounds[n - 1])
+			throw std::runtime_error("Metrics::addHistogram(): the bounds of '" + name + "' are not ascending");
+
+	std::lock_guard<std::mutex> guard(this->lock);
+
+	const auto * existing = this->find(name, TYPE_HISTOGRAM);
+
+	if(existing) {
+		if(existing->histogram->getBounds() != bounds)
+			throw std::runtime_error("Metrics::addHistogram(): '" + name + "' has already been added with other bounds");
+
+		return *(existing->histogram);
+	}
+
+	auto entry = std::make_unique<Entry>();
+
+	entry->name = name;
+	entry->help = help;
+	entry->type = TYPE_HISTOGRAM;
+	entry->histogram = std::make_unique<Histogram>(bounds);
+
+	auto& result = *(entry->histogram);
+
+	this->entries.emplace_back(std::move(entry));
+
+	return result;
+}
+
+// get all metrics in the Prometheus text format
+std::string Metrics::str() const {
+	std::ostringstream out;
+
+	out.precision(15);
+
+	std::lock_guard<std::mutex> guard(this->lock);
+
+	for(const auto& entry : this->entries) {
+		out << "# HELP " << entry->name << " " << entry->help << "\n";
+
+		switch(entry->type) {
+		case TYPE_COUNTER:
+			out << "# TYPE " << entry->name << " counter\n";
+			out << entry->name << " " << entry->counter->get() << "\n";
+
+			break;
+
+		case TYPE_GAUGE:
+			out << "# TYPE " << entry->name << " gauge\n";
+			out << entry->name << " " << entry->gauge->get() << "\n";
+
+			break;
+
+		case TYPE_HISTOGRAM: {
+			const auto& histogram = *(entry->histogram);
+			const auto& bounds = histogram.getBounds();
+			uint64_t cumulative = 0;
+
+			out << "# TYPE " << entry->name << " histogram\n";
+
+			for(std::size_t n = 0; n < bounds.size(); ++n) {
+				cumulative += histogram.getBucket(n);
+
+				out << entry->name << "_bucket{le=\"" << bounds[n] << "\"} " << cumulative << "\n";
+			}
+
+			cumulative += histogram.getBucket(bounds.size());
+
+			out << entry->name << "_bucket{le=\"+Inf\"} " << cumulative << "\n";
+			out << entry->name << "_sum " << histogram.getSum() << "\n";
+			out << entry->name << "_count " << cumulative << "\n";
+
+			break;
+		}
+		}
+	}
+
+	return out.str();
+}
+
+// write all metrics into the specified file every interval (in seconds), replacing the file atomically
+void Metrics::exportToFile(const std::string& fileName, double interval) {
+	this->stop();
+
+	this->fileName = fileName;
+	this->socketPath.clear();
+
+	this->start(interval);
+}
+
+// serve all metrics via a Unix domain socket at the specified path, updating them every interval (in seconds)
+//	NOTE:	Every client connecting to the socket will receive the current metrics, after which the connection will be closed.
+void Metrics::exportToSocket(const std::string& path, double interval) {
+	if(interval <= 0.)
+		throw std::runtime_error("Metrics::exportToSocket(): invalid interval");
+
+	this->stop();
+
+	sockaddr_un address{};
+
+	if(path.size() >= sizeof address.sun_path)
+		throw std::runtime_error("Metrics::exportToSocket(): path '" + path + "' is too long");
+
+	address.sun_family = AF_UNIX;
+
+	std::strncpy(address.sun_path, path.c_str(), sizeof address.sun_path - 1);
+
+	this->socketFd = socket(AF_UNIX, SOCK_STREAM, 0);
+
+	if(this->socketFd < 0)
+		throw std::runtime_error("Metrics::exportToSocket(): could not create socket");
+
+	// only replace an old socket, never anything else at the path
+	struct stat status{};
+
+	if(!lstat(path.c_str(), &status)) {
+		if(!S_ISSOCK(status.st_mode)) {
+			close(this->socketFd);
+
+			this->socketFd = -1;
+
+			throw std::runtime_error("Metrics::exportToSocket(): '" + path + "' exists and is not a socket");
+		}
+
+		unlink(path.c_str());
+	}
+
+	if(
+			bind(this->socketFd, reinterpret_cast<const sockaddr *>(&address), sizeof address)
+			|| listen(this->socketFd, 8)
+	) {
+		close(this->socketFd);
+
+		this->socketFd = -1;
+
+		throw std::runtime_error("Metrics::exportToSocket(): could not listen at '" + path + "'");
+	}
+
+	this->fileName.clear();
+	this->socketPath = path;
+
+	this->start(interval);
+}
+
+// stop exporting the metrics
+void Metrics::stop() {
+	{
+		std::lock_guard<std::mutex> guard(this->exporterLock);
+
+		this->running = false;
+	}
+
+	this->exporterCondition.notify_one();
+
+	if(this->exporter.joinable())
+		this->exporter.join();
+
+	if(this->socketFd >= 0) {
+		close(this->socketFd);
+
+		// remove the socket (unless it has been replaced by something else in the meantime)
+		struct stat status{};
+
+		if(!lstat(this->socketPath.c_str(), &status) && S_ISSOCK(status.st_mode))
+			unlink(this->socketPath.c_str());
+
+		this->socketFd = -1;
+	}
+}
+
+// start the exporting thread
+void Metrics::start(double interval) {
+	if(interval <= 0.)
+		throw std::runtime_error("Metrics::start(): invalid interval");
+
+	this->interval = interval;
+	this->running = true;
+
+	this->exporter = std::thread(&Metrics::thread, this);
+}
+
+// thread exporting the metrics every interval
+void Metrics::thread() {
+	const auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+			std::chrono::duration<double>(this->interval)
+	);
+
+	while(true) {
+		const auto until = std::chrono::steady_clock::now() + interval;
+		const std::string text(this->str());
+
+		if(this->socketFd >= 0)
+			this->serveSocket(text, until);
+		else
+			this->writeFile(text);
+
+		std::unique_lock<std::mutex> guard(this->exporterLock);
+
+		if(this->exporterCondition.wait_until(guard, until, [this] { return !(this->running); }))
+			break;
+	}
+}
+
+// write the specified text into the export file, ignoring any errors
+void Metrics::writeFile(const std::string& text) {
+	const std::string temporaryName(this->fileName + ".tmp");
+
+	{
+		std::ofstream out(temporaryName, std::ios::trunc);
+
+		out << text;
+
+		if(!out)
+			return;
+	}
+
+	std::rename(temporaryName.c_str(), this->fileName.c_str());
+}
+
+// send the specified text to every client connecting to the socket until the specified time or until stopped
+void Metrics::serveSocket(const std::string& text, std::chrono::steady_clock::time_point until) {
+	constexpr int maxWait = 100;	// maximum time to wait for a client (in milliseconds) before checking whether to stop
+
+	while(true) {
+		{
+			std::lock_guard<std::mutex> guard(this->exporterLock);
+
+			if(!(this->running))
+				return;
+		}
+
+		const auto left = std::chrono::duration_cast<std::chrono::milliseconds>(until - std::chrono::steady_clock::now());
+
+		if(left.count() <= 0)
+			return;
+
+		pollfd request{};
+
+		request.fd = this->socketFd;
+		request.events = POLLIN;
+
+		if(poll(&request, 1, std::min(static_cast<int>(left.count()), maxWait)) <= 0)
+			continue;
+
+		const int client = accept(this->socketFd, nullptr, nullptr);
+
+		if(client < 0)
+			continue;
+
+		std::size_t written = 0;
+
+		while(written < text.size()) {
+			// do not raise SIGPIPE if the client has already disconnected
+			const auto result = send(client, text.data() + written, text.size() - written, MSG_NOSIGNAL);
+
+			if(result <= 0)
+				break;
+
+			written += result;
+		}
+
+		close(client);
+	}
+}
+
+// find the metric with the specified name, which needs to be of the specified type (nullptr if it has not been added yet)
+//	NOTE:	The registry needs to be locked by the caller.
+const Metrics::Entry * Metrics::find(const std::string& name, Type type) const {
+	for(const auto& entry : this->entries)
+		if(entry->name == name) {
+			if(entry->type != type)
+				throw std::runtime_error("Metrics::find(): '" + name + "' has already been added with another type");
+
+			return entry.get();
+		}
+
+	return nullptr;
+}
+
+// get the bits of a double, so that it can be stored in an atomic integer
+uint64_t Metrics::toBits(double value) {
+	uint64_t bits = 0;
+
+	std::memcpy(&bits, &value, sizeof bits);
+
+	return bits;
+}
+
+// get the double stored in the specified bits
+double Metrics::fromBits(uint64_t bits) {
+	double value = 0.;
+
+	std::memcpy(&value, &bits, sizeof value);
+
+	return value;
+}
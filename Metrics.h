@@ -0,0 +1,142 @@
+/*
+ * Metrics.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef METRICS_H_
+#define METRICS_H_
+
+#pragma once
+
+#include <poll.h>		// poll, pollfd, POLLIN
+#include <sys/socket.h>	// accept, bind, listen, send, socket, AF_UNIX, MSG_NOSIGNAL, SOCK_STREAM
+#include <sys/stat.h>	// lstat, S_ISSOCK
+#include <sys/un.h>		// sockaddr_un
+#include <unistd.h>		// close, unlink
+
+#include <algorithm>	// std::min
+#include <atomic>		// std::atomic, std::memory_order
+#include <chrono>		// std::chrono
+#include <condition_variable>	// std::condition_variable
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint64_t
+#include <cstdio>		// std::rename
+#include <cstring>		// std::memcpy, std::strncpy
+#include <fstream>		// std::ofstream
+#include <memory>		// std::make_unique, std::unique_ptr
+#include <mutex>		// std::lock_guard, std::mutex, std::unique_lock
+#include <sstream>		// std::ostringstream
+#include <stdexcept>	// std::runtime_error
+#include <string>		// std::string
+#include <thread>		// std::thread
+#include <vector>		// std::vector
+
+// registry of counters, gauges and histograms, exported in the Prometheus text format by a background thread
+//	NOTE:	Metrics need to be added before they are used, which is NOT real-time safe.
+//			Updating a metric only uses lock-free atomic operations, i.e. it will never block the calling thread.
+class Metrics {
+public:
+	// monotonically increasing counter
+	class Counter {
+	public:
+		void add(uint64_t n = 1) { this->value.fetch_add(n, std::memory_order_relaxed); }
+		uint64_t get() const { return this->value.load(std::memory_order_relaxed); }
+
+	private:
+		std::atomic<uint64_t> value{0};
+	};
+
+	// value that can go up and down
+	class Gauge {
+	public:
+		void set(double value) { this->bits.store(Metrics::toBits(value), std::memory_order_relaxed); }
+		double get() const { return Metrics::fromBits(this->bits.load(std::memory_order_relaxed)); }
+
+	private:
+		std::atomic<uint64_t> bits{0};
+	};
+
+	// distribution of values in buckets with fixed upper bounds
+	class Histogram {
+	public:
+		Histogram(const std::vector<double>& bounds);
+
+		void observe(double value);
+
+		const std::vector<double>& getBounds() const;
+		uint64_t getBucket(std::size_t index) const;
+		uint64_t getCount() const;
+		double getSum() const;
+
+	private:
+		std::vector<double> bounds;
+		std::unique_ptr<std::atomic<uint64_t>[]> buckets;
+		std::atomic<uint64_t> count;
+		std::atomic<uint64_t> sumBits;
+	};
+
+	// default bounds for histograms of durations (in seconds)
+	static const std::vector<double> defaultTimeBounds;
+
+	Metrics();
+	virtual ~Metrics();
+
+	Counter& addCounter(const std::string& name, const std::string& help);
+	Gauge& addGauge(const std::string& name, const std::string& help);
+	Histogram& addHistogram(
+			const std::string& name,
+			const std::string& help,
+			const std::vector<double>& bounds = Metrics::defaultTimeBounds
+	);
+
+	std::string str() const;
+
+	void exportToFile(const std::string& fileName, double interval);
+	void exportToSocket(const std::string& path, double interval);
+	void stop();
+
+	Metrics(const Metrics&) = delete;
+	Metrics& operator=(const Metrics&) = delete;
+
+private:
+	enum Type {
+		TYPE_COUNTER,
+		TYPE_GAUGE,
+		TYPE_HISTOGRAM
+	};
+
+	struct Entry {
+		std::string name;
+		std::string help;
+		Type type;
+		std::unique_ptr<Counter> counter;
+		std::unique_ptr<Gauge> gauge;
+		std::unique_ptr<Histogram> histogram;
+	};
+
+	void start(double interval);
+	void thread();
+	void writeFile(const std::string& text);
+	void serveSocket(const std::string& text, std::chrono::steady_clock::time_point until);
+	const Entry * find(const std::string& name, Type type) const;
+
+	static uint64_t toBits(double value);
+	static double fromBits(uint64_t bits);
+
+	mutable std::mutex lock;
+	std::vector<std::unique_ptr<Entry>> entries;
+
+	std::thread exporter;
+	std::mutex exporterLock;
+	std::condition_variable exporterCondition;
+	bool running;
+
+	std::string fileName;
+	std::string socketPath;
+	int socketFd;
+	double interval;
+};
+
+#endif /* METRICS_H_ */
@@ -8,7 +8,7 @@
 #include "Pixels.h"
 
 // constructor and destructor
-Pixels::Pixels() : width(0), height(0), bytes(0), pixels(nullptr), allocated(false) {}
+Pixels::Pixels() : width(0), height(0), bytes(0), pixels(nullptr), allocated(false), allocatedSize(0) {}
 Pixels::~Pixels() {
 	this->deallocate();
 
@@ -25,15 +25,23 @@ void Pixels::map(int w, int h, unsigned char b, unsigned char * ptr) {
 
 // fill all the mapped pixel with one color (r, g, b, a)
 void Pixels::fill(unsigned char r, unsigned char g, unsigned char b, unsigned char a) {
-	for(auto x = 0; x < this->width; ++x)
-		for(auto y = 0; y < this->height; ++y) {
-			const auto offset = y * this->width * this->bytes + x * this->bytes;
-
-			this->pixels[offset] = r;
-			this->pixels[offset + 1] = g;
-			this->pixels[offset + 2] = b;
-			this->pixels[offset + 3] = a;
-		}
+	const auto count = static_cast<std::size_t>(this->width) * this->height;
+
+	if(this->bytes == 4) {
+		// write whole pixels in memory order
+		std::fill_n(reinterpret_cast<uint32_t *>(this->pixels), count, Pixels::pack(r, g, b, a));
+
+		return;
+	}
+
+	for(std::size_t n = 0; n < count; ++n) {
+		const auto offset = n * this->bytes;
+
+		this->pixels[offset] = r;
+		this->pixels[offset + 1] = g;
+		this->pixels[offset + 2] = b;
+		this->pixels[offset + 3] = a;
+	}
 }
 
 // set one of the mapped pixel (x, y) to the specified color (r, g, b, a)
@@ -46,24 +54,149 @@ void Pixels::set(int x, int y, unsigned char r, unsigned char g, unsigned char b
 	this->pixels[offset + 3] = a;
 }
 
+// copy a rectangle (sourceX, sourceY, w, h) from the specified source to the specified position (x, y),
+//	integer scaling, flipping and skipping pixels with a color key (see Pixels::pack) are optional
+//	NOTE:	The destination rectangle will be clipped. Both buffers need to use four bytes per pixel.
+void Pixels::blit(
+		const Pixels& source,
+		int sourceX,
+		int sourceY,
+		int w,
+		int h,
+		int x,
+		int y,
+		unsigned int scale,
+		unsigned char flags,
+		uint32_t colorKey
+) {
+	if(this->bytes != 4 || source.bytes != 4)
+		throw std::runtime_error("Pixels::blit(): only four bytes per pixel are supported");
+
+	if(sourceX < 0 || sourceY < 0 || sourceX + w > source.width || sourceY + h > source.height)
+		throw std::runtime_error("Pixels::blit(): source rectangle out of bounds");
+
+	if(!scale || w <= 0 || h <= 0)
+		return;
+
+	// clip the destination rectangle
+	const int s = static_cast<int>(scale);
+	const int fromX = x < 0 ? 0 : x;
+	const int fromY = y < 0 ? 0 : y;
+	const int toX = x + w * s > this->width ? this->width : x + w * s;
+	const int toY = y + h * s > this->height ? this->height : y + h * s;
+
+	if(fromX >= toX || fromY >= toY)
+		return;
+
+	const int n = toX - fromX;
+	const bool flipX = flags & BLIT_FLIP_X;
+	const bool flipY = flags & BLIT_FLIP_Y;
+	const bool keyed = flags & BLIT_COLOR_KEY;
+	const bool direct = s == 1 && !flipX;
+
+	// only compare the color, not the alpha value, of the color key
+	const uint32_t colorMask = Pixels::pack(255, 255, 255, 0);
+
+	colorKey &= colorMask;
+
+	if(!direct && this->line.size() < static_cast<std::size_t>(n))
+		this->line.resize(n);
+
+	const auto * sourcePixels = reinterpret_cast<const uint32_t *>(source.pixels);
+	auto * targetPixels = reinterpret_cast<uint32_t *>(this->pixels);
+
+	int targetY = fromY;
+
+	while(targetY < toY) {
+		// get the source row and the number of target rows it will be copied to
+		const int relY = (targetY - y) / s;
+		const int rowY = sourceY + (flipY ? h - 1 - relY : relY);
+		const int rowsLeft = (relY + 1) * s + y - targetY;
+		const int rows = targetY + rowsLeft > toY ? toY - targetY : rowsLeft;
+		const uint32_t * row = sourcePixels + static_cast<std::size_t>(rowY) * source.width + sourceX;
+		const uint32_t * from = nullptr;
+
+		if(direct)
+			from = row + (fromX - x);
+		else {
+			// prepare the (scaled and/or flipped) row
+			if(s == 1)
+				Pixels::copyReversed(this->line.data(), row + (w - 1 - (toX - 1 - x)), n);
+			else
+				for(int relX = 0; relX < n; ++relX) {
+					const int column = (fromX - x + relX) / s;
+
+					this->line[relX] = row[flipX ? w - 1 - column : column];
+				}
+
+			from = this->line.data();
+		}
+
+		// copy whole rows
+		for(int rowN = 0; rowN < rows; ++rowN) {
+			auto * to = targetPixels + static_cast<std::size_t>(targetY + rowN) * this->width + fromX;
+
+			if(keyed)
+				Pixels::copyKeyed(to, from, n, colorKey);
+			else
+				std::memcpy(to, from, n * sizeof(uint32_t));
+		}
+
+		targetY += rows;
+	}
+}
+
 // get the pointer to the pixels
 void * Pixels::get() {
 	return this->pixels;
 }
 
+// get the pointer to the pixels for reading only
+const void * Pixels::get() const {
+	return this->pixels;
+}
+
 // unset the pointer to the mapped pixels
 void Pixels::unmap() {
 	this->pixels = nullptr;
 }
 
+// exchange the pixels (and their ownership) with the specified other pixels without copying them
+void Pixels::swap(Pixels& other) {
+	std::swap(this->width, other.width);
+	std::swap(this->height, other.height);
+	std::swap(this->bytes, other.bytes);
+	std::swap(this->pixels, other.pixels);
+	std::swap(this->allocated, other.allocated);
+	std::swap(this->allocatedSize, other.allocatedSize);
+	std::swap(this->line, other.line);
+}
+
+// get the width of the pixels
+int Pixels::getWidth() const {
+	return this->width;
+}
+
+// get the height of the pixels
+int Pixels::getHeight() const {
+	return this->height;
+}
+
+// get the number of bytes per pixel
+unsigned char Pixels::getBytes() const {
+	return this->bytes;
+}
+
 // allocate pixel buffer in system memory for the specified width (w), height(h) and bytes per pixel (b)
-void Pixels::allocate(int w, int h, unsigned char b) {
+//	NOTE:	The buffer will be aligned to a cache line and pre-faulted, large buffers will use huge pages if available.
+void Pixels::allocate(int w, int h, unsigned char b, Memory::HugePages hugePages) {
 	this->deallocate();
 
 	this->width = w;
 	this->height = h;
 	this->bytes = b;
-	this->pixels = new unsigned char[this->width * this->height * this->bytes];
+	this->allocatedSize = static_cast<std::size_t>(this->width) * this->height * this->bytes;
+	this->pixels = static_cast<unsigned char *>(Memory::allocate(this->allocatedSize, hugePages));
 
 	if(this->pixels) {
 		this->allocated = true;
@@ -76,11 +209,12 @@ void Pixels::allocate(int w, int h, unsigned char b) {
 // deallocate pixel buffer if necessary
 void Pixels::deallocate() {
 	if(this->allocated) {
-		delete[] this->pixels;
+		Memory::deallocate(this->pixels, this->allocatedSize);
 
 		this->pixels = nullptr;
 
 		this->allocated = false;
+		this->allocatedSize = 0;
 	}
 }
 
@@ -88,3 +222,48 @@ void Pixels::deallocate() {
 Pixels::operator bool() const {
 	return this->pixels != nullptr;
 }
+
+// copy pixels that do not have the specified color (already masked to exclude the alpha value)
+void Pixels::copyKeyed(uint32_t * to, const uint32_t * from, int n, uint32_t colorKey) {
+	const uint32_t colorMask = Pixels::pack(255, 255, 255, 0);
+
+	int i = 0;
+
+#ifdef __SSE2__
+	// select four pixels at once
+	const __m128i keys = _mm_set1_epi32(static_cast<int>(colorKey));
+	const __m128i masks = _mm_set1_epi32(static_cast<int>(colorMask));
+
+	for(; i + 4 <= n; i += 4) {
+		const __m128i sourceValues = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + i));
+		const __m128i targetValues = _mm_loadu_si128(reinterpret_cast<const __m128i *>(to + i));
+		const __m128i isKey = _mm_cmpeq_epi32(_mm_and_si128(sourceValues, masks), keys);
+
+		_mm_storeu_si128(
+				reinterpret_cast<__m128i *>(to + i),
+				_mm_or_si128(_mm_and_si128(isKey, targetValues), _mm_andnot_si128(isKey, sourceValues))
+		);
+	}
+#endif
+
+	for(; i < n; ++i)
+		if((from[i] & colorMask) != colorKey)
+			to[i] = from[i];
+}
+
+// copy pixels in reversed order
+void Pixels::copyReversed(uint32_t * to, const uint32_t * from, int n) {
+	int i = 0;
+
+#ifdef __SSE2__
+	// reverse four pixels at once
+	for(; i + 4 <= n; i += 4) {
+		const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(from + n - 4 - i));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(to + i), _mm_shuffle_epi32(values, _MM_SHUFFLE(0, 1, 2, 3)));
+	}
+#endif
+
+	for(; i < n; ++i)
+		to[i] = from[n - 1 - i];
+}
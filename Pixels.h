@@ -10,20 +10,72 @@
 
 #pragma once
 
+#include <algorithm>	// std::fill_n
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint32_t
+#include <cstring>		// std::memcpy
 #include <stdexcept>	// std::runtime_error
+#include <utility>		// std::swap
+#include <vector>		// std::vector
+
+#ifdef __SSE2__
+#include <emmintrin.h>	// SSE2 intrinsics
+#endif
+
+#include "Memory.h"
 
 class Pixels {
 public:
+	// options for copying pixels (can be combined)
+	enum BlitFlags {
+		BLIT_NONE = 0,
+		BLIT_FLIP_X = 1,		// mirror horizontally
+		BLIT_FLIP_Y = 2,		// mirror vertically
+		BLIT_COLOR_KEY = 4		// do not copy pixels with the color key (alpha is ignored)
+	};
+
+	// pack a color (r, g, b, a) into one 32-bit value with the bytes in memory order
+	static constexpr uint32_t pack(unsigned char r, unsigned char g, unsigned char b, unsigned char a = 255) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		return (static_cast<uint32_t>(r) << 24) | (static_cast<uint32_t>(g) << 16) | (static_cast<uint32_t>(b) << 8) | a;
+#else
+		return r | (static_cast<uint32_t>(g) << 8) | (static_cast<uint32_t>(b) << 16) | (static_cast<uint32_t>(a) << 24);
+#endif
+	}
+
+	// average two packed colors (see Pixels::pack) channel by channel, rounding down
+	static constexpr uint32_t average(uint32_t a, uint32_t b) {
+		return (a & b) + (((a ^ b) & 0xfefefefe) >> 1);
+	}
+
 	Pixels();
 	virtual ~Pixels();
 
 	void map(int w, int h, unsigned char b, unsigned char * ptr);
 	void fill(unsigned char r, unsigned char g, unsigned char b, unsigned char a);
 	void set(int x, int y, unsigned char r, unsigned char g, unsigned char b, unsigned char a);
+	void blit(
+			const Pixels& source,
+			int sourceX,
+			int sourceY,
+			int w,
+			int h,
+			int x,
+			int y,
+			unsigned int scale = 1,
+			unsigned char flags = BLIT_NONE,
+			uint32_t colorKey = 0
+	);
 	void * get();
+	const void * get() const;
 	void unmap();
+	void swap(Pixels& other);
+
+	int getWidth() const;
+	int getHeight() const;
+	unsigned char getBytes() const;
 
-	void allocate(int w, int h, unsigned char b);
+	void allocate(int w, int h, unsigned char b, Memory::HugePages hugePages = Memory::HUGE_PAGES_TRANSPARENT);
 	void deallocate();
 
 	operator bool() const;
@@ -35,6 +87,12 @@ private:
 	unsigned char * pixels;
 
 	bool allocated;
+	std::size_t allocatedSize;
+
+	std::vector<uint32_t> line;
+
+	static void copyKeyed(uint32_t * to, const uint32_t * from, int n, uint32_t colorKey);
+	static void copyReversed(uint32_t * to, const uint32_t * from, int n);
 };
 
 #endif /* PIXELS_H_ */
@@ -0,0 +1,434 @@
+/*
+ * PostProcess.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "PostProcess.h"
+
+// constructor using all but one of the available cores for workers (the calling thread will be used, too)
+PostProcess::PostProcess()
+		: width(0),
+		  height(0),
+		  rowSize(0),
+		  poolStarted(false),
+		  threads(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0) {}
+
+// destructor stub
+PostProcess::~PostProcess() {}
+
+// set the number of additional worker threads (zero means processing all rows in the rendering thread)
+void PostProcess::setThreads(unsigned int threads) {
+	this->threads = threads;
+
+	if(this->poolStarted) {
+		this->pool.stop();
+
+		this->poolStarted = false;
+	}
+}
+
+// set the scheduling configuration of the worker threads, each of which will be pinned to one of its CPUs
+void PostProcess::setThreadConfig(const ThreadConfig& config) {
+	this->pool.setThreadConfig(config);
+
+	if(this->poolStarted) {
+		this->pool.stop();
+
+		this->poolStarted = false;
+	}
+}
+
+// check whether the scheduling configuration of the worker threads has been applied with errors and get them
+bool PostProcess::isThreadConfigErrorsOccured(std::string& errorsOut) {
+	return this->pool.isThreadConfigErrorsOccured(errorsOut);
+}
+
+// add a separable gaussian blur with the specified radius (in pixels) and standard deviation
+//	NOTE:	A standard deviation of zero means half the radius.
+void PostProcess::addGaussianBlur(unsigned int radius, double sigma) {
+	if(!radius)
+		return;
+
+	Filter filter(FILTER_BLUR);
+
+	filter.radius = static_cast<int>(radius);
+	filter.weights = PostProcess::gaussianWeights(radius, sigma);
+
+	this->filters.emplace_back(filter);
+}
+
+// add a 3x3 or 5x5 convolution with the specified kernel (in reading order, i.e. from top left to bottom right)
+//	NOTE:	The kernel will be divided by the divisor, the bias (in color values) will be added afterwards.
+void PostProcess::addConvolution(const std::vector<double>& kernel, double divisor, double bias) {
+	if(kernel.size() != 9 && kernel.size() != 25)
+		throw std::runtime_error(
+				"PostProcess::addConvolution(): invalid kernel size ("
+				+ std::to_string(kernel.size())
+				+ ", 3x3 or 5x5 expected)"
+		);
+
+	if(divisor == 0.)
+		throw std::runtime_error("PostProcess::addConvolution(): divisor is zero");
+
+	Filter filter(FILTER_CONVOLUTION);
+
+	filter.radius = kernel.size() == 9 ? 1 : 2;
+
+	filter.weights.reserve(kernel.size());
+
+	for(const auto value : kernel)
+		filter.weights.push_back(static_cast<int32_t>(std::lround(value / divisor * (1 << precision))));
+
+	filter.bias = static_cast<int32_t>(std::lround(bias * (1 << precision)));
+
+	this->filters.emplace_back(filter);
+}
+
+// add color grading using one look-up table for each color channel
+void PostProcess::addColorGrading(const LUT& r, const LUT& g, const LUT& b) {
+	Filter filter(FILTER_COLOR_GRADING);
+
+	filter.lut[0] = r;
+	filter.lut[1] = g;
+	filter.lut[2] = b;
+
+	this->filters.emplace_back(filter);
+}
+
+// add bloom, i.e. blur the pixels with at least the specified luminance and add them to the image
+void PostProcess::addBloom(unsigned char threshold, unsigned int radius, double intensity) {
+	if(!radius)
+		throw std::runtime_error("PostProcess::addBloom(): radius is zero");
+
+	Filter filter(FILTER_BLOOM);
+
+	filter.radius = static_cast<int>(radius);
+	filter.weights = PostProcess::gaussianWeights(radius, 0.);
+	filter.threshold = threshold;
+	filter.intensity = static_cast<int32_t>(std::lround(intensity * (1 << precision)));
+
+	this->filters.emplace_back(filter);
+}
+
+// remove all filters
+void PostProcess::clear() {
+	this->filters.clear();
+}
+
+// apply all filters to the specified pixels (with four bytes per pixel)
+//	NOTE:	Buffers will only be (re-)allocated when the size of the pixels changes.
+void PostProcess::apply(Pixels& pixels) {
+	if(this->filters.empty() || !pixels)
+		return;
+
+	if(pixels.getBytes() != 4)
+		throw std::runtime_error("PostProcess::apply(): only four bytes per pixel are supported");
+
+	// start the worker threads if necessary
+	if(!(this->poolStarted)) {
+		this->pool.start(this->threads);
+
+		this->accumulators.clear();
+
+		this->poolStarted = true;
+	}
+
+	// (re-)allocate buffers if necessary
+	this->width = pixels.getWidth();
+	this->height = pixels.getHeight();
+	this->rowSize = static_cast<std::size_t>(this->width) * 4;
+
+	const std::size_t size = this->rowSize * this->height;
+
+	if(this->buffers[0].size() != size)
+		this->buffers[0].resize(size);
+
+	for(const auto& filter : this->filters)
+		if(filter.type == FILTER_BLOOM) {
+			if(this->buffers[1].size() != size)
+				this->buffers[1].resize(size);
+
+			if(this->buffers[2].size() != size)
+				this->buffers[2].resize(size);
+
+			break;
+		}
+
+	this->accumulators.resize(this->pool.getBands());
+
+	for(auto& accumulator : this->accumulators)
+		if(accumulator.size() != this->rowSize)
+			accumulator.resize(this->rowSize);
+
+	// apply the filters, swapping buffers where necessary
+	auto * frame = static_cast<unsigned char *>(pixels.get());
+	unsigned char * current = frame;
+	unsigned char * other = this->buffers[0].data();
+
+	struct {
+		const Filter * filter;
+		unsigned char * from;
+		unsigned char * to;
+	} pass;
+
+	for(const auto& filter : this->filters) {
+		pass.filter = &filter;
+
+		switch(filter.type) {
+		case FILTER_BLUR:
+			this->blur(filter, current, other);
+
+			break;
+
+		case FILTER_CONVOLUTION:
+			pass.from = current;
+			pass.to = other;
+
+			this->pool.run(this->height, [this, &pass](std::size_t begin, std::size_t end, unsigned int band) {
+				for(auto y = begin; y < end; ++y)
+					this->convolute(*(pass.filter), pass.from, pass.to, y, this->accumulators[band].data());
+			});
+
+			std::swap(current, other);
+
+			break;
+
+		case FILTER_COLOR_GRADING:
+			pass.to = current;
+
+			this->pool.run(this->height, [this, &pass](std::size_t begin, std::size_t end, unsigned int) {
+				for(auto y = begin; y < end; ++y)
+					this->grade(*(pass.filter), pass.to, y);
+			});
+
+			break;
+
+		case FILTER_BLOOM:
+			pass.from = current;
+			pass.to = this->buffers[1].data();
+
+			this->pool.run(this->height, [this, &pass](std::size_t begin, std::size_t end, unsigned int) {
+				for(auto y = begin; y < end; ++y)
+					this->brightPass(*(pass.filter), pass.from, pass.to, y);
+			});
+
+			this->blur(filter, this->buffers[1].data(), this->buffers[2].data());
+
+			pass.from = this->buffers[1].data();
+			pass.to = current;
+
+			this->pool.run(this->height, [this, &pass](std::size_t begin, std::size_t end, unsigned int) {
+				for(auto y = begin; y < end; ++y)
+					this->addBright(*(pass.filter), pass.from, pass.to, y);
+			});
+
+			break;
+		}
+	}
+
+	// copy the result back into the pixels if necessary
+	if(current != frame)
+		std::memcpy(frame, current, size);
+}
+
+// check whether any filters have been added
+PostProcess::operator bool() const {
+	return !(this->filters.empty());
+}
+
+// blur the data in two passes (horizontally into the temporary buffer, then vertically back)
+void PostProcess::blur(const Filter& filter, unsigned char * data, unsigned char * temp) {
+	struct {
+		const Filter * filter;
+		unsigned char * data;
+		unsigned char * temp;
+	} pass { &filter, data, temp };
+
+	this->pool.run(this->height, [this, &pass](std::size_t begin, std::size_t end, unsigned int band) {
+		for(auto y = begin; y < end; ++y)
+			this->blurHorizontal(*(pass.filter), pass.data, pass.temp, y, this->accumulators[band].data());
+	});
+
+	this->pool.run(this->height, [this, &pass](std::size_t begin, std::size_t end, unsigned int band) {
+		for(auto y = begin; y < end; ++y)
+			this->blurVertical(*(pass.filter), pass.temp, pass.data, y, this->accumulators[band].data());
+	});
+}
+
+// blur one row horizontally
+void PostProcess::blurHorizontal(const Filter& filter, const unsigned char * from, unsigned char * to, int y, int32_t * acc) {
+	const int n = static_cast<int>(this->rowSize);
+	const unsigned char * row = from + y * this->rowSize;
+
+	std::fill(acc, acc + n, 1 << (precision - 1));
+
+	for(int k = 0; k <= 2 * filter.radius; ++k) {
+		const int32_t weight = filter.weights[k];
+		const int offset = (k - filter.radius) * 4;
+		const int begin = std::max(0, -offset);
+		const int end = std::min(n, n - offset);
+
+		// clamp to the first and the last pixel at the edges
+		for(int j = 0; j < begin && j < n; ++j)
+			acc[j] += weight * row[j & 3];
+
+		for(int j = begin; j < end; ++j)
+			acc[j] += weight * row[j + offset];
+
+		for(int j = std::max(end, 0); j < n; ++j)
+			acc[j] += weight * row[n - 4 + (j & 3)];
+	}
+
+	unsigned char * out = to + y * this->rowSize;
+
+	for(int j = 0; j < n; ++j)
+		out[j] = PostProcess::clamp(acc[j] >> precision);
+}
+
+// blur one row vertically
+void PostProcess::blurVertical(const Filter& filter, const unsigned char * from, unsigned char * to, int y, int32_t * acc) {
+	const int n = static_cast<int>(this->rowSize);
+
+	std::fill(acc, acc + n, 1 << (precision - 1));
+
+	for(int k = 0; k <= 2 * filter.radius; ++k) {
+		const int32_t weight = filter.weights[k];
+		const int rowY = std::min(std::max(y + k - filter.radius, 0), this->height - 1);
+		const unsigned char * row = from + rowY * this->rowSize;
+
+		for(int j = 0; j < n; ++j)
+			acc[j] += weight * row[j];
+	}
+
+	unsigned char * out = to + y * this->rowSize;
+
+	for(int j = 0; j < n; ++j)
+		out[j] = PostProcess::clamp(acc[j] >> precision);
+}
+
+// convolute one row (keeping the alpha values)
+void PostProcess::convolute(const Filter& filter, const unsigned char * from, unsigned char * to, int y, int32_t * acc) {
+	const int n = static_cast<int>(this->rowSize);
+	const int size = 2 * filter.radius + 1;
+
+	std::fill(acc, acc + n, (1 << (precision - 1)) + filter.bias);
+
+	for(int ky = 0; ky < size; ++ky) {
+		// the first row of the kernel is the top one, i.e. the one with the highest y
+		const int rowY = std::min(std::max(y + filter.radius - ky, 0), this->height - 1);
+		const unsigned char * row = from + rowY * this->rowSize;
+
+		for(int kx = 0; kx < size; ++kx) {
+			const int32_t weight = filter.weights[ky * size + kx];
+			const int offset = (kx - filter.radius) * 4;
+			const int begin = std::max(0, -offset);
+			const int end = std::min(n, n - offset);
+
+			if(!weight)
+				continue;
+
+			for(int j = 0; j < begin && j < n; ++j)
+				acc[j] += weight * row[j & 3];
+
+			for(int j = begin; j < end; ++j)
+				acc[j] += weight * row[j + offset];
+
+			for(int j = std::max(end, 0); j < n; ++j)
+				acc[j] += weight * row[n - 4 + (j & 3)];
+		}
+	}
+
+	const unsigned char * in = from + y * this->rowSize;
+	unsigned char * out = to + y * this->rowSize;
+
+	for(int j = 0; j < n; ++j)
+		out[j] = PostProcess::clamp(acc[j] >> precision);
+
+	for(int j = 3; j < n; j += 4)
+		out[j] = in[j];
+}
+
+// apply the look-up tables to one row
+void PostProcess::grade(const Filter& filter, unsigned char * data, int y) {
+	unsigned char * row = data + y * this->rowSize;
+
+	for(std::size_t j = 0; j < this->rowSize; j += 4) {
+		row[j] = filter.lut[0][row[j]];
+		row[j + 1] = filter.lut[1][row[j + 1]];
+		row[j + 2] = filter.lut[2][row[j + 2]];
+	}
+}
+
+// extract the pixels of one row that are at least as bright as the threshold
+void PostProcess::brightPass(const Filter& filter, const unsigned char * from, unsigned char * to, int y) {
+	const unsigned char * in = from + y * this->rowSize;
+	unsigned char * out = to + y * this->rowSize;
+
+	for(std::size_t j = 0; j < this->rowSize; j += 4) {
+		// approximate the luminance (Rec. 709)
+		const int luminance = (54 * in[j] + 183 * in[j + 1] + 19 * in[j + 2]) >> 8;
+		const unsigned char mask = luminance >= filter.threshold ? 255 : 0;
+
+		out[j] = in[j] & mask;
+		out[j + 1] = in[j + 1] & mask;
+		out[j + 2] = in[j + 2] & mask;
+		out[j + 3] = 0;
+	}
+}
+
+// add the blurred bright pixels of one row to the image (keeping the alpha values)
+void PostProcess::addBright(const Filter& filter, const unsigned char * from, unsigned char * to, int y) {
+	const unsigned char * in = from + y * this->rowSize;
+	unsigned char * out = to + y * this->rowSize;
+
+	for(std::size_t j = 0; j < this->rowSize; ++j) {
+		const int32_t added = out[j] + ((in[j] * filter.intensity) >> precision);
+
+		out[j] = (j & 3) == 3 ? out[j] : PostProcess::clamp(added);
+	}
+}
+
+// clamp a value to [0;255]
+unsigned char PostProcess::clamp(int32_t value) {
+	return static_cast<unsigned char>(value < 0 ? 0 : (value > 255 ? 255 : value));
+}
+
+// calculate the (normalized, fixed-point) weights of a one-dimensional gaussian kernel
+std::vector<int32_t> PostProcess::gaussianWeights(unsigned int radius, double sigma) {
+	if(sigma <= 0.)
+		sigma = radius / 2.;
+
+	if(sigma <= 0.)
+		sigma = 1.;
+
+	const int r = static_cast<int>(radius);
+
+	std::vector<double> values;
+	double sum = 0.;
+
+	values.reserve(2 * r + 1);
+
+	for(int n = -r; n <= r; ++n) {
+		values.push_back(std::exp(- (n * n) / (2. * sigma * sigma)));
+
+		sum += values.back();
+	}
+
+	std::vector<int32_t> result;
+	int32_t total = 0;
+
+	result.reserve(values.size());
+
+	for(const auto value : values) {
+		result.push_back(static_cast<int32_t>(std::lround(value / sum * (1 << precision))));
+
+		total += result.back();
+	}
+
+	// make sure the weights add up to exactly one to keep the brightness
+	result[r] += (1 << precision) - total;
+
+	return result;
+}
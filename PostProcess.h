@@ -0,0 +1,103 @@
+/*
+ * PostProcess.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef POSTPROCESS_H_
+#define POSTPROCESS_H_
+
+#pragma once
+
+#include <algorithm>	// std::max, std::min, std::swap
+#include <array>		// std::array
+#include <cmath>		// std::exp, std::lround
+#include <cstddef>		// std::size_t
+#include <cstdint>		// int32_t
+#include <cstring>		// std::memcpy
+#include <stdexcept>	// std::runtime_error
+#include <string>		// std::string, std::to_string
+#include <thread>		// std::thread
+#include <vector>		// std::vector
+
+#include "Memory.h"
+#include "Pixels.h"
+#include "ThreadConfig.h"
+#include "WorkerPool.h"
+
+// chain of full-screen filters applied to the pixels after a frame has been rendered
+//	NOTE:	The filters will be applied in the order they have been added.
+//			All of them work in bands of rows that will be processed in parallel.
+class PostProcess {
+public:
+	using LUT = std::array<unsigned char, 256>;
+
+	PostProcess();
+	virtual ~PostProcess();
+
+	void setThreads(unsigned int threads);
+	void setThreadConfig(const ThreadConfig& config);
+	bool isThreadConfigErrorsOccured(std::string& errorsOut);
+
+	void addGaussianBlur(unsigned int radius, double sigma = 0.);
+	void addConvolution(const std::vector<double>& kernel, double divisor = 1., double bias = 0.);
+	void addColorGrading(const LUT& r, const LUT& g, const LUT& b);
+	void addBloom(unsigned char threshold, unsigned int radius, double intensity = 1.);
+	void clear();
+
+	void apply(Pixels& pixels);
+
+	operator bool() const;
+
+private:
+	// fixed-point precision of the weights
+	static constexpr int precision = 14;
+
+	using Buffer = std::vector<unsigned char, Memory::Allocator<unsigned char>>;
+
+	enum FilterType {
+		FILTER_BLUR,
+		FILTER_CONVOLUTION,
+		FILTER_COLOR_GRADING,
+		FILTER_BLOOM
+	};
+
+	struct Filter {
+		FilterType type;
+		int radius;
+		std::vector<int32_t> weights;	// fixed-point weights of the (separable) kernel
+		int32_t bias;					// fixed-point bias
+		LUT lut[3];
+		unsigned char threshold;
+		int32_t intensity;				// fixed-point intensity
+
+		Filter(FilterType _type) : type(_type), radius(0), bias(0), lut(), threshold(0), intensity(0) {}
+	};
+
+	void blur(const Filter& filter, unsigned char * data, unsigned char * temp);
+	void blurHorizontal(const Filter& filter, const unsigned char * from, unsigned char * to, int y, int32_t * acc);
+	void blurVertical(const Filter& filter, const unsigned char * from, unsigned char * to, int y, int32_t * acc);
+	void convolute(const Filter& filter, const unsigned char * from, unsigned char * to, int y, int32_t * acc);
+	void grade(const Filter& filter, unsigned char * data, int y);
+	void brightPass(const Filter& filter, const unsigned char * from, unsigned char * to, int y);
+	void addBright(const Filter& filter, const unsigned char * from, unsigned char * to, int y);
+
+	static unsigned char clamp(int32_t value);
+	static std::vector<int32_t> gaussianWeights(unsigned int radius, double sigma);
+
+	std::vector<Filter> filters;
+
+	int width;
+	int height;
+	std::size_t rowSize;
+
+	Buffer buffers[3];
+	std::vector<std::vector<int32_t>> accumulators;
+
+	WorkerPool pool;
+	bool poolStarted;
+	unsigned int threads;
+};
+
+#endif /* POSTPROCESS_H_ */
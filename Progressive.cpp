@@ -0,0 +1,204 @@
+/*
+ * Progressive.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "Progressive.h"
+
+// constructors and destructor
+Progressive::Progressive() : Progressive(Progressive::defaultBudget) {}
+
+Progressive::Progressive(double budget)
+		: width(0),
+		  height(0),
+		  budget(budget),
+		  unchecked(0),
+		  blockSize(0),
+		  blockRows(0),
+		  blockBits(0),
+		  rowIndex(0),
+		  blockX(0),
+		  blockY(-1),
+		  samples(0),
+		  finished(false) {
+	this->reset();
+}
+
+Progressive::~Progressive() {}
+
+// set the time (in seconds) that may be spent on refining the scene every frame
+//	NOTE:	The budget will be checked every few samples (see Progressive::checkInterval),
+//			i.e. at least that many samples will be taken every frame.
+void Progressive::setBudget(double seconds) {
+	this->budget = seconds;
+}
+
+// start refining the scene again from the first pass, e.g. because it has changed
+//	NOTE:	The pixels of the last rendering will be kept until they are overwritten by the new passes.
+void Progressive::reset() {
+	this->samples = 0;
+	this->finished = false;
+
+	this->startPass(Progressive::maxBlockSize);
+}
+
+// start a new frame with the specified size of the scene (w, h), resetting the scene if its size has changed
+void Progressive::begin(int w, int h) {
+	if(w != this->width || h != this->height) {
+		this->width = w;
+		this->height = h;
+
+		this->image.assign(static_cast<std::size_t>(w) * h, Pixels::pack(0, 0, 0));
+
+		this->reset();
+	}
+
+	this->start = std::chrono::steady_clock::now();
+	this->unchecked = 0;
+}
+
+// get the next pixel to be sampled (x, y) and the size of the block to be filled with its color,
+//	return false if the scene has been completely refined or the time budget for the current frame has been used up
+bool Progressive::next(int& x, int& y, int& size) {
+	if(this->finished)
+		return false;
+
+	// check the time budget every few samples
+	if(++(this->unchecked) > Progressive::checkInterval) {
+		const std::chrono::duration<double> elapsed(std::chrono::steady_clock::now() - this->start);
+
+		if(elapsed.count() > this->budget)
+			return false;
+
+		this->unchecked = 1;
+	}
+
+	while(true) {
+		// get the next row of blocks (in interleaved order)
+		if(this->blockY < 0) {
+			while(this->rowIndex < (1 << this->blockBits)) {
+				const int row = Progressive::reverseBits(this->rowIndex, this->blockBits);
+
+				++(this->rowIndex);
+
+				if(row < this->blockRows) {
+					this->blockX = 0;
+					this->blockY = row * this->blockSize;
+
+					break;
+				}
+			}
+
+			if(this->blockY < 0) {
+				// the current pass has been finished
+				if(this->blockSize == 1) {
+					this->finished = true;
+
+					return false;
+				}
+
+				this->startPass(this->blockSize / 2);
+
+				continue;
+			}
+		}
+
+		// skip blocks that have already been sampled in the previous pass
+		const int twice = this->blockSize * 2;
+
+		if(
+				this->blockSize < Progressive::maxBlockSize
+				&& this->blockY % twice == 0
+				&& this->blockX % twice == 0
+		)
+			this->blockX += this->blockSize;
+
+		if(this->blockX >= this->width) {
+			this->blockY = -1;
+
+			continue;
+		}
+
+		x = this->blockX;
+		y = this->blockY;
+		size = this->blockSize;
+
+		this->blockX += this->blockSize;
+
+		++(this->samples);
+
+		return true;
+	}
+}
+
+// fill the block of the specified size at the specified position (x, y) with the specified packed color (see Pixels::pack)
+void Progressive::set(int x, int y, int size, uint32_t color) {
+	const int w = std::min(size, this->width - x);
+	const int h = std::min(size, this->height - y);
+
+	for(int row = 0; row < h; ++row)
+		std::fill_n(this->image.data() + static_cast<std::size_t>(y + row) * this->width + x, w, color);
+}
+
+// get the width of the scene
+int Progressive::getWidth() const {
+	return this->width;
+}
+
+// get the height of the scene
+int Progressive::getHeight() const {
+	return this->height;
+}
+
+// get the specified row of the scene (as packed colors)
+const uint32_t * Progressive::getRow(int y) const {
+	return this->image.data() + static_cast<std::size_t>(y) * this->width;
+}
+
+// get the time budget per frame (in seconds)
+double Progressive::getBudget() const {
+	return this->budget;
+}
+
+// get the share of pixels that have already been sampled (from 0 to 1)
+double Progressive::getProgress() const {
+	if(this->finished)
+		return 1.;
+
+	const std::size_t total = static_cast<std::size_t>(this->width) * this->height;
+
+	return total ? static_cast<double>(this->samples) / total : 0.;
+}
+
+// get whether the scene has been completely refined
+bool Progressive::isFinished() const {
+	return this->finished;
+}
+
+// start a new pass with the specified block size
+void Progressive::startPass(int size) {
+	this->blockSize = size;
+	this->blockRows = (this->height + size - 1) / size;
+	this->blockBits = 0;
+
+	while((1 << this->blockBits) < this->blockRows)
+		++(this->blockBits);
+
+	this->rowIndex = 0;
+	this->blockX = 0;
+	this->blockY = -1;
+}
+
+// reverse the specified number of lower bits of the specified value
+int Progressive::reverseBits(int value, int bits) {
+	int result = 0;
+
+	for(int bit = 0; bit < bits; ++bit) {
+		result = (result << 1) | (value & 1);
+		value >>= 1;
+	}
+
+	return result;
+}
@@ -0,0 +1,79 @@
+/*
+ * Progressive.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef PROGRESSIVE_H_
+#define PROGRESSIVE_H_
+
+#pragma once
+
+#include <algorithm>	// std::fill_n, std::min
+#include <chrono>		// std::chrono
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint32_t
+#include <vector>		// std::vector
+
+#include "Memory.h"
+#include "Pixels.h"
+
+// state of a scene that is rendered progressively over multiple frames, within a time budget per frame (see Engine::refine)
+//	NOTE:	The pixels will be sampled in passes of decreasing block size, each block being filled with the color of its sample
+//			until it is refined by the next pass. Within each pass, the rows of blocks will be processed in an interleaved
+//			(i.e. bit-reversed) order, so that the refinement spreads evenly over the whole scene.
+//			All coordinates are in logical pixels (i.e. independent of the pixel size of the window).
+class Progressive {
+public:
+	// size of the blocks in the first (i.e. coarsest) pass, in logical pixels (needs to be a power of two)
+	static constexpr int maxBlockSize = 16;
+
+	// number of samples between checks of the time budget
+	static constexpr std::size_t checkInterval = 64;
+
+	// default time budget per frame (in seconds)
+	static constexpr double defaultBudget = 0.008;
+
+	Progressive();
+	Progressive(double budget);
+	virtual ~Progressive();
+
+	void setBudget(double seconds);
+	void reset();
+
+	void begin(int w, int h);
+	bool next(int& x, int& y, int& size);
+	void set(int x, int y, int size, uint32_t color);
+
+	int getWidth() const;
+	int getHeight() const;
+	const uint32_t * getRow(int y) const;
+	double getBudget() const;
+	double getProgress() const;
+	bool isFinished() const;
+
+private:
+	void startPass(int size);
+
+	static int reverseBits(int value, int bits);
+
+	int width;
+	int height;
+	std::vector<uint32_t, Memory::Allocator<uint32_t>> image;
+
+	double budget;
+	std::chrono::steady_clock::time_point start;
+	std::size_t unchecked;
+
+	int blockSize;
+	int blockRows;
+	int blockBits;
+	int rowIndex;
+	int blockX;
+	int blockY;
+	std::size_t samples;
+	bool finished;
+};
+
+#endif /* PROGRESSIVE_H_ */
@@ -8,26 +8,7 @@
 #include "Rand.h"
 
 // constructor for using the default algorithm (or setting it later)
-Rand::Rand()
-		: algo(RAND_ALGO_STD_RAND),
-		  byteMin(0),
-		  byteMax(std::numeric_limits<unsigned char>::max()),
-		  byteHalf(std::numeric_limits<unsigned char>::max() / 2),
-		  intMin(0),
-		  intMax(std::numeric_limits<int>::max()),
-		  intHalf(std::numeric_limits<int>::max() / 2),
-		  realMin(0.),
-		  realMax(1.),
-		  realHalf(.5),
-		  lehmer(0) {
-	const auto defaultSeed = std::random_device()();
-
-	std::srand(defaultSeed);
-
-	this->mt.seed(defaultSeed);
-
-	this->lehmer = defaultSeed;
-}
+Rand::Rand() : algo(RAND_ALGO_STD_RAND) {}
 
 // constructor setting the algorithm
 Rand::Rand(Algo algo) : Rand() {
@@ -39,22 +20,9 @@ Rand::~Rand() {}
 
 // set the seed ONLY for the currently selected algorithm
 void Rand::seed(unsigned int s) {
-	switch(this->algo) {
-	case RAND_ALGO_STD_RAND:
-		std::srand(s);
-
-		break;
-
-	case RAND_ALGO_STD_MT19937:
-		this->mt.seed(s);
-
-		break;
-
-	case RAND_ALGO_LEHMER32:
-		this->lehmer = s;
-
-		break;
-	}
+	this->visit([s](auto& rand) {
+		rand.seed(s);
+	});
 }
 
 // set the current algorithm
@@ -65,6 +33,17 @@ void Rand::setAlgo(Algo value) {
 	this->algo = value;
 }
 
+// get an independent generator for the specified stream using the current algorithm (see BasicRand::split)
+Rand Rand::split(unsigned int stream) const {
+	Rand result(*this);
+
+	result.visit([stream](auto& rand) {
+		rand = rand.split(stream);
+	});
+
+	return result;
+}
+
 // get the current algorithm
 Rand::Algo Rand::getAlgo() const {
 	return this->algo;
@@ -72,166 +51,77 @@ Rand::Algo Rand::getAlgo() const {
 
 // get the name of the current algorithm
 std::string Rand::str() const {
-	switch(this->algo) {
-	case RAND_ALGO_STD_RAND:
-		return "std::rand";
-
-	case RAND_ALGO_STD_MT19937:
-		return "std::mt19937";
-
-	case RAND_ALGO_LEHMER32:
-		return "lehmer32";
-	}
-
-	return "undefined";
+	return this->visit([](const auto& rand) {
+		return std::string(rand.str());
+	});
 }
 
 // set the limits for pseudo-random byte creation (default: 0 to std::numeric_limits<unsigned char>::max())
 void Rand::setByteLimits(unsigned char from, unsigned char to) {
-	if(from > to) {
-		if(this->byteMin == from && this->byteMax == to)
-			return;
-
-		this->byteMin = to;
-		this->byteMax = from;
-	}
-	else {
-		if(this->byteMin == to && this->byteMax == from)
-			return;
-
-		this->byteMin = from;
-		this->byteMax = to;
-	}
-
-	this->byteHalf = static_cast<unsigned char>((this->byteMax - this->byteMin) / 2);
-
-	std::uniform_int_distribution<unsigned char> newByteDist(this->byteMin, this->byteMax);
-
-	std::swap(this->byteDist, newByteDist);
+	this->forEach([from, to](auto& rand) {
+		rand.setByteLimits(from, to);
+	});
 }
 
 // set the limits for pseudo-random integer creation (default: 0 to std::numeric_limits<int>::max())
 void Rand::setIntLimits(int from, int to) {
-	if(from > to) {
-		if(this->intMin == from && this->intMax == to)
-			return;
-
-		this->intMin = to;
-		this->intMax = from;
-	}
-	else {
-		if(this->intMin == to && this->intMax == from)
-			return;
-
-		this->intMin = from;
-		this->intMax = to;
-	}
-
-	this->intHalf = (this->intMax - this->intMin) / 2;
-
-	std::uniform_int_distribution<int> newIntDist(this->intMin, this->intMax);
-
-	std::swap(this->intDist, newIntDist);
+	this->forEach([from, to](auto& rand) {
+		rand.setIntLimits(from, to);
+	});
 }
 
 // set the limits for pseudo-random float creation (default: 0 to 1)
 void Rand::setRealLimits(double from, double to) {
-	if(from > to) {
-		if(this->realMin == from && this->realMax == to)
-			return;
-
-		this->realMin = to;
-		this->realMax = from;
-	}
-	else {
-		if(this->realMin == to && this->realMax == from)
-			return;
-
-		this->realMin = from;
-		this->realMax = to;
-	}
-
-	this->realHalf = (this->realMax - this->realMin) / 2;
-
-	std::uniform_real_distribution<double> newRealDist(this->realMin, this->realMax);
-
-	std::swap(this->realDist, newRealDist);
+	this->forEach([from, to](auto& rand) {
+		rand.setRealLimits(from, to);
+	});
 }
 
 // generate a pseudo-random byte
 unsigned char Rand::generateByte() {
-	switch(this->algo) {
-	case RAND_ALGO_STD_RAND:
-		return static_cast<unsigned char>(this->byteMin + std::rand() % (this->byteMax + 1 - this->byteMin));
-
-	case RAND_ALGO_STD_MT19937:
-		return this->byteDist(this->mt);
-
-	case RAND_ALGO_LEHMER32:
-		return static_cast<unsigned char>(this->byteMin + this->lehmer32() % (this->byteMax + 1 - this->byteMin));
-	}
-
-	return 0;
+	return this->visit([](auto& rand) {
+		return rand.generateByte();
+	});
 }
 
 // generate a pseudo-random integer
 int Rand::generateInt() {
-	switch(this->algo) {
-	case RAND_ALGO_STD_RAND:
-		return this->intMin + std::rand() % (this->intMax + 1 - this->intMin);
-
-	case RAND_ALGO_STD_MT19937:
-		return this->intDist(this->mt);
-
-	case RAND_ALGO_LEHMER32:
-		return this->intMin + this->lehmer32() % (this->intMax + 1 - this->intMin);
-	}
-
-	return 0;
+	return this->visit([](auto& rand) {
+		return rand.generateInt();
+	});
 }
 
 // generate a pseudo-random real number
 double Rand::generateReal() {
-	switch(this->algo) {
-	case RAND_ALGO_STD_RAND:
-		return this->realMin + static_cast<double>(std::rand()) / RAND_MAX * (this->realMax - this->realMin);
-
-	case RAND_ALGO_STD_MT19937:
-		return this->realDist(this->mt);
-
-	case RAND_ALGO_LEHMER32:
-		return this->realMin + static_cast<double>(this->lehmer32()) / 0xFFFFFFFF * (this->realMax - this->realMin);
-	}
-
-	return 0;
+	return this->visit([](auto& rand) {
+		return rand.generateReal();
+	});
 }
 
 // generate a pseudo-random boolean value
 bool Rand::generateBool() {
-	switch(this->algo) {
-	case RAND_ALGO_STD_RAND:
-		return std::rand() > RAND_MAX / 2;
-
-	case RAND_ALGO_STD_MT19937:
-		return this->byteDist(this->mt) - this->byteMin > this->byteHalf;
-
-	case RAND_ALGO_LEHMER32:
-		return this->lehmer32() > 0xFFFFFFFF / 2;
-	}
-
-	return false;
+	return this->visit([](auto& rand) {
+		return rand.generateBool();
+	});
 }
 
-// 32-bit Lehmer generator
-uint32_t Rand::lehmer32() {
-	this->lehmer += 0xe120fc15;
-
-	uint64_t tmp = static_cast<uint64_t>(this->lehmer) * 0x4a39b70d;
-	uint32_t m1 = static_cast<uint32_t>((tmp >> 32) ^ tmp);
-
-	tmp = static_cast<uint64_t>(m1) * 0x12fad5c9;
+// fill the specified buffer with pseudo-random bytes (see BasicRand::generateBytes)
+void Rand::generateBytes(unsigned char * out, std::size_t n) {
+	this->visit([out, n](auto& rand) {
+		rand.generateBytes(out, n);
+	});
+}
 
-	uint32_t m2 = static_cast<uint32_t>((tmp >> 32) ^ tmp);
+// fill the specified buffer with pseudo-random integers (see BasicRand::generateInts)
+void Rand::generateInts(int * out, std::size_t n) {
+	this->visit([out, n](auto& rand) {
+		rand.generateInts(out, n);
+	});
+}
 
-	return m2;
+// fill the specified buffer with pseudo-random real numbers (see BasicRand::generateReals)
+void Rand::generateReals(double * out, std::size_t n) {
+	this->visit([out, n](auto& rand) {
+		rand.generateReals(out, n);
+	});
 }
@@ -10,20 +10,28 @@
 
 #pragma once
 
-#include <cstdlib>		// std::rand
-#include <limits>		// std::numeric_limits
-#include <random>		// std::mt19937, std::random_device, std::uniform_int_distribution, std::uniform_real_distribution
+#include <cstddef>		// std::size_t
 #include <stdexcept>	// std::runtime_error
-#include <string>		// std::string
+#include <string>		// std::string, std::to_string
 
-constexpr unsigned char RAND_ALGO_NUM = 3;
+#include "BasicRand.h"
 
+constexpr unsigned char RAND_ALGO_NUM = 8;
+
+// pseudo-random number generation with the algorithm chosen at runtime
+//	NOTE:	Every call will switch on the current algorithm, use Rand::visit to switch only once for many calls
+//			or BasicRand to choose the algorithm at compile time.
 class Rand {
 public:
 	enum Algo {
 		RAND_ALGO_STD_RAND = 0,
 		RAND_ALGO_STD_MT19937 = 1,
-		RAND_ALGO_LEHMER32 = 2
+		RAND_ALGO_LEHMER32 = 2,
+		RAND_ALGO_XOSHIRO256PP = 3,
+		RAND_ALGO_XOSHIRO128P = 4,
+		RAND_ALGO_PCG32 = 5,
+		RAND_ALGO_WYRAND = 6,
+		RAND_ALGO_SPLITMIX64 = 7
 	};
 
 	Rand();
@@ -33,6 +41,8 @@ public:
 	void seed(unsigned int s);
 	void setAlgo(Algo n);
 
+	Rand split(unsigned int stream) const;
+
 	Algo getAlgo() const;
 	std::string str() const;
 
@@ -45,27 +55,102 @@ public:
 	double generateReal();
 	bool generateBool();
 
+	void generateBytes(unsigned char * out, std::size_t n);
+	void generateInts(int * out, std::size_t n);
+	void generateReals(double * out, std::size_t n);
+
+	template<typename Function> auto visit(Function function);
+	template<typename Function> auto visit(Function function) const;
+
 private:
+	template<typename Function> void forEach(Function function);
+
 	Algo algo;
 
-	unsigned char byteMin;
-	unsigned char byteMax;
-	unsigned char byteHalf;
-	int intMin;
-	int intMax;
-	int intHalf;
-	double realMin;
-	double realMax;
-	double realHalf;
+	BasicRand<RandGenerator::StdRand> stdRand;
+	BasicRand<RandGenerator::MT19937> mt;
+	BasicRand<RandGenerator::Lehmer32> lehmer;
+	BasicRand<RandGenerator::Xoshiro256PlusPlus> xoshiro256pp;
+	BasicRand<RandGenerator::Xoshiro128Plus> xoshiro128p;
+	BasicRand<RandGenerator::PCG32> pcg32;
+	BasicRand<RandGenerator::Wyrand> wyrand;
+	BasicRand<RandGenerator::SplitMix64> splitmix64;
+};
+
+// call the specified function with the BasicRand of the current algorithm (e.g. to generate many numbers without switching every time)
+//	NOTE:	The function will be called as function(BasicRand<Generator>& rand) and needs to accept every generator,
+//			e.g. by using a generic lambda.
+template<typename Function> auto Rand::visit(Function function) {
+	switch(this->algo) {
+	case RAND_ALGO_STD_RAND:
+		return function(this->stdRand);
 
-	std::mt19937 mt;
+	case RAND_ALGO_STD_MT19937:
+		return function(this->mt);
 
-	std::uniform_int_distribution<unsigned char> byteDist;
-	std::uniform_int_distribution<int> intDist;
-	std::uniform_real_distribution<double> realDist;
+	case RAND_ALGO_LEHMER32:
+		return function(this->lehmer);
 
-	uint32_t lehmer;
-	uint32_t lehmer32();
-};
+	case RAND_ALGO_XOSHIRO256PP:
+		return function(this->xoshiro256pp);
+
+	case RAND_ALGO_XOSHIRO128P:
+		return function(this->xoshiro128p);
+
+	case RAND_ALGO_PCG32:
+		return function(this->pcg32);
+
+	case RAND_ALGO_WYRAND:
+		return function(this->wyrand);
+
+	case RAND_ALGO_SPLITMIX64:
+		break;
+	}
+
+	return function(this->splitmix64);
+}
+
+// call the specified function with the (constant) BasicRand of the current algorithm
+template<typename Function> auto Rand::visit(Function function) const {
+	switch(this->algo) {
+	case RAND_ALGO_STD_RAND:
+		return function(this->stdRand);
+
+	case RAND_ALGO_STD_MT19937:
+		return function(this->mt);
+
+	case RAND_ALGO_LEHMER32:
+		return function(this->lehmer);
+
+	case RAND_ALGO_XOSHIRO256PP:
+		return function(this->xoshiro256pp);
+
+	case RAND_ALGO_XOSHIRO128P:
+		return function(this->xoshiro128p);
+
+	case RAND_ALGO_PCG32:
+		return function(this->pcg32);
+
+	case RAND_ALGO_WYRAND:
+		return function(this->wyrand);
+
+	case RAND_ALGO_SPLITMIX64:
+		break;
+	}
+
+	return function(this->splitmix64);
+}
+
+// call the specified function with the BasicRand of every algorithm
+template<typename Function> void Rand::forEach(Function function) {
+	function(this->stdRand);
+	function(this->mt);
+	function(this->lehmer);
+	function(this->xoshiro256pp);
+	function(this->xoshiro128p);
+	function(this->pcg32);
+	function(this->wyrand);
+	function(this->splitmix64);
+}
 
 #endif /* RAND_H_ */
@@ -0,0 +1,50 @@
+/*
+ * RandHash.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef RANDHASH_H_
+#define RANDHASH_H_
+
+#pragma once
+
+#include <cstdint>		// uint32_t, uint64_t
+#include <cstring>		// std::memcpy
+
+#include "BasicRand.h"
+
+// counter-based (i.e. stateless) pseudo-random numbers, addressed by a seed and an index (or coordinates)
+//	NOTE:	Every number can be computed independently of all others, e.g. by any thread and in any order,
+//			and the same seed and index will always result in the same number.
+namespace RandHash {
+	// get the pseudo-random 64-bit number at the specified index
+	inline uint64_t get64(uint64_t seed, uint64_t index) {
+		return RandGenerator::SplitMix64::hash(
+				RandGenerator::SplitMix64::hash(seed) + (index + 1) * 0x9e3779b97f4a7c15
+		);
+	}
+
+	// get the pseudo-random 32-bit number at the specified index
+	inline uint32_t get(uint64_t seed, uint64_t index) {
+		return static_cast<uint32_t>(get64(seed, index) >> 32);
+	}
+
+	// get the pseudo-random 32-bit number at the specified coordinates (e.g. of a pixel) in the specified frame
+	inline uint32_t get(uint64_t seed, uint32_t x, uint32_t y, uint32_t frame) {
+		return get(seed + RandGenerator::SplitMix64::hash(frame), (static_cast<uint64_t>(y) << 32) | x);
+	}
+
+	// get the pseudo-random real number from 0 to (excluding) 1 at the specified index
+	inline double getReal(uint64_t seed, uint64_t index) {
+		const uint64_t bits = 0x3FF0000000000000 | (get64(seed, index) >> 12);
+		double one = 0.;
+
+		std::memcpy(&one, &bits, sizeof one);
+
+		return one - 1.;
+	}
+}
+
+#endif /* RANDHASH_H_ */
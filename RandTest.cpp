@@ -0,0 +1,178 @@
+/*
+ * RandTest.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#include "RandTest.h"
+
+// constructor
+RandTest::RandTest() : fileName("randtest.md"), sink(0.) {}
+
+// destructor
+RandTest::~RandTest() {}
+
+// test every algorithm and write the results into the file specified as first argument (default: randtest.md)
+int RandTest::run(int argc, char * argv[]) {
+	if(argc > 1)
+		this->fileName = argv[1];
+
+	for(unsigned char n = 0; n < RAND_ALGO_NUM; ++n) {
+		Rand generator(static_cast<Rand::Algo>(n));
+		Result result{};
+
+		result.name = generator.str();
+
+		std::cout << "Testing " << result.name << "..." << std::endl;
+
+		generator.seed(RandTest::seed);
+
+		generator.visit([this, &result](auto& rand) {
+			this->test(rand, result);
+		});
+
+		this->results.emplace_back(result);
+	}
+
+	this->write();
+
+	return EXIT_SUCCESS;
+}
+
+// write the results as a Markdown table into the file and to stdout
+void RandTest::write() const {
+	std::ostringstream table;
+
+	table << "| algorithm | bytes | gap | birthday | serial | pairs"
+			" | ns/byte | ns/int | ns/real | ns/byte (bulk) | ns/int (bulk) | ns/real (bulk) |\n";
+	table << "|---|---|---|---|---|---|---|---|---|---|---|---|\n";
+
+	for(const auto& result : this->results) {
+		table << "| " << result.name
+				<< " | " << RandTest::format(result.bytes)
+				<< " | " << RandTest::format(result.gap)
+				<< " | " << RandTest::format(result.birthday)
+				<< " | " << RandTest::format(result.serial)
+				<< " | ";
+
+		if(result.pairs)
+			table << "2^" << static_cast<unsigned int>(std::log2(result.pairs) + .5);
+		else
+			table << "< 2^" << RandTest::minPairs << " (!)";
+
+		table << std::fixed << std::setprecision(2)
+				<< " | " << result.nsByte
+				<< " | " << result.nsInt
+				<< " | " << result.nsReal
+				<< " | " << result.nsBytes
+				<< " | " << result.nsInts
+				<< " | " << result.nsReals
+				<< " |\n";
+
+		table.unsetf(std::ios_base::floatfield);
+	}
+
+	std::ofstream out(this->fileName);
+
+	if(!out)
+		throw std::runtime_error("RandTest::write(): could not open '" + this->fileName + "'");
+
+	out << table.str();
+
+	std::cout << std::endl << table.str() << std::endl << "Results written to " << this->fileName << std::endl;
+}
+
+// get the p-value of a chi-square test of the specified observed against the expected counts
+double RandTest::chiSquare(const std::vector<double>& observed, const std::vector<double>& expected) {
+	double chi = 0.;
+
+	for(std::size_t n = 0; n < observed.size(); ++n) {
+		const double difference = observed[n] - expected[n];
+
+		chi += difference * difference / expected[n];
+	}
+
+	return RandTest::chiSquareP(chi, static_cast<double>(observed.size() - 1));
+}
+
+// get the probability of a chi-square value at least as large as the specified one
+double RandTest::chiSquareP(double chi, double degrees) {
+	return RandTest::upperGamma(degrees / 2, chi / 2);
+}
+
+// get the regularized upper incomplete gamma function Q(a, x),
+//	using its series for x < a + 1 and its continued fraction (by Lentz's method) otherwise
+double RandTest::upperGamma(double a, double x) {
+	constexpr unsigned int maxIterations = 1000000;
+	constexpr double epsilon = 1e-15;
+	constexpr double tiny = 1e-300;
+
+	if(x <= 0.)
+		return 1.;
+
+	const double factor = std::exp(-x + a * std::log(x) - std::lgamma(a));
+
+	if(x < a + 1.) {
+		double term = 1. / a;
+		double sum = term;
+
+		for(unsigned int n = 1; n < maxIterations; ++n) {
+			term *= x / (a + n);
+			sum += term;
+
+			if(std::fabs(term) < std::fabs(sum) * epsilon)
+				break;
+		}
+
+		return 1. - sum * factor;
+	}
+
+	double b = x + 1. - a;
+	double c = 1. / tiny;
+	double d = 1. / b;
+	double h = d;
+
+	for(unsigned int n = 1; n < maxIterations; ++n) {
+		const double an = -(n * (n - a));
+
+		b += 2.;
+		d = an * d + b;
+
+		if(std::fabs(d) < tiny)
+			d = tiny;
+
+		c = b + an / c;
+
+		if(std::fabs(c) < tiny)
+			c = tiny;
+
+		d = 1. / d;
+
+		const double delta = d * c;
+
+		h *= delta;
+
+		if(std::fabs(delta - 1.) < epsilon)
+			break;
+	}
+
+	return h * factor;
+}
+
+// get the (two-sided) probability of a standard normally distributed value at least as far from zero as the specified one
+double RandTest::normalP(double z) {
+	return std::erfc(std::fabs(z) / std::sqrt(2.));
+}
+
+// format a p-value, marking suspicious ones
+std::string RandTest::format(double p) {
+	std::ostringstream out;
+
+	out << std::fixed << std::setprecision(4) << p;
+
+	if(p < 0.001 || p > 0.999)
+		out << " (!)";
+
+	return out.str();
+}
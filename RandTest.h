@@ -0,0 +1,296 @@
+/*
+ * RandTest.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef RANDTEST_H_
+#define RANDTEST_H_
+
+#pragma once
+
+#include "Rand.h"
+
+#include <algorithm>	// std::nth_element, std::sort
+#include <chrono>		// std::chrono
+#include <cmath>		// std::erfc, std::exp, std::fabs, std::lgamma, std::log, std::log2, std::pow, std::sqrt
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint16_t
+#include <cstdlib>		// EXIT_SUCCESS
+#include <fstream>		// std::ofstream
+#include <iomanip>		// std::setprecision
+#include <iostream>		// std::cout, std::endl
+#include <sstream>		// std::ostringstream
+#include <stdexcept>	// std::runtime_error
+#include <string>		// std::string
+#include <vector>		// std::vector
+
+// statistical tests and throughput of every algorithm for pseudo-random number generation,
+//	written into a Markdown table to compare the quality traded for speed
+//	NOTE:	Every test results in a p-value, values below 0.001 or above 0.999 are considered suspicious.
+//			The streaming test doubles the number of tested pairs of bytes until the test fails (like PractRand),
+//			and reports the number of pairs that passed.
+//			All generators will be seeded with the same number, i.e. the results are reproducible.
+class RandTest {
+public:
+	static constexpr unsigned int seed = 1;
+
+	// number of values per test
+	static constexpr std::size_t bytes = 1 << 24;
+	static constexpr std::size_t gaps = 1 << 20;
+	static constexpr std::size_t reals = 1 << 22;
+	static constexpr std::size_t birthdayTrials = 1000;
+
+	// streaming test from 2^minPairs to 2^maxPairs pairs of bytes
+	static constexpr unsigned int minPairs = 20;
+	static constexpr unsigned int maxPairs = 26;
+
+	// number of values and repetitions for measuring throughput
+	static constexpr std::size_t iterations = 1 << 22;
+	static constexpr unsigned int repetitions = 5;
+
+	RandTest();
+	virtual ~RandTest();
+
+	int run(int argc, char * argv[]);
+
+private:
+	struct Result {
+		std::string name;
+
+		double bytes;
+		double gap;
+		double birthday;
+		double serial;
+		std::size_t pairs;
+
+		double nsByte;
+		double nsInt;
+		double nsReal;
+		double nsBytes;
+		double nsInts;
+		double nsReals;
+	};
+
+	template<typename Generator> void test(BasicRand<Generator>& rand, Result& result);
+	template<typename Function> double measure(Function function);
+
+	void write() const;
+
+	static double chiSquare(const std::vector<double>& observed, const std::vector<double>& expected);
+	static double chiSquareP(double chi, double degrees);
+	static double upperGamma(double a, double x);
+	static double normalP(double z);
+	static std::string format(double p);
+
+	std::string fileName;
+	std::vector<Result> results;
+	volatile double sink;
+};
+
+// run all tests on the specified generator and measure its throughput
+template<typename Generator> void RandTest::test(BasicRand<Generator>& rand, Result& result) {
+	// chi-square test of the distribution of bytes
+	{
+		std::vector<unsigned char> values(RandTest::bytes);
+		std::vector<double> counts(256, 0.);
+
+		rand.generateBytes(values.data(), values.size());
+
+		for(const auto value : values)
+			++counts[value];
+
+		result.bytes = RandTest::chiSquare(counts, std::vector<double>(256, static_cast<double>(RandTest::bytes) / 256));
+	}
+
+	// gap test: lengths of the gaps between real numbers below one half
+	{
+		constexpr std::size_t maxGap = 10;
+
+		std::vector<double> counts(maxGap + 1, 0.);
+		std::vector<double> expected(maxGap + 1, 0.);
+		std::size_t gap = 0;
+
+		for(std::size_t n = 0; n < RandTest::gaps;) {
+			if(rand.generateReal() < .5) {
+				++counts[std::min(gap, maxGap)];
+				++n;
+
+				gap = 0;
+			}
+			else
+				++gap;
+		}
+
+		for(std::size_t n = 0; n < maxGap; ++n)
+			expected[n] = RandTest::gaps * std::pow(.5, n + 1);
+
+		expected[maxGap] = RandTest::gaps * std::pow(.5, maxGap);
+
+		result.gap = RandTest::chiSquare(counts, expected);
+	}
+
+	// birthday spacings: number of repeated spacings between 512 sorted birthdays in a year of 2^24 days
+	//	(Poisson distributed with a mean of 2)
+	{
+		constexpr std::size_t birthdays = 512;
+		constexpr std::size_t maxRepeated = 6;
+		constexpr double mean = 2.;
+
+		std::vector<int> days(birthdays);
+		std::vector<int> spacings(birthdays);
+		std::vector<double> counts(maxRepeated + 1, 0.);
+		std::vector<double> expected(maxRepeated + 1, 0.);
+
+		rand.setIntLimits(0, (1 << 24) - 1);
+
+		for(std::size_t trial = 0; trial < RandTest::birthdayTrials; ++trial) {
+			rand.generateInts(days.data(), days.size());
+
+			std::sort(days.begin(), days.end());
+
+			spacings[0] = days[0];
+
+			for(std::size_t n = 1; n < birthdays; ++n)
+				spacings[n] = days[n] - days[n - 1];
+
+			std::sort(spacings.begin(), spacings.end());
+
+			std::size_t repeated = 0;
+
+			for(std::size_t n = 1; n < birthdays; ++n)
+				if(spacings[n] == spacings[n - 1])
+					++repeated;
+
+			++counts[std::min(repeated, maxRepeated)];
+		}
+
+		double probability = std::exp(-mean);
+		double rest = 1.;
+
+		for(std::size_t n = 0; n < maxRepeated; ++n) {
+			expected[n] = RandTest::birthdayTrials * probability;
+
+			rest -= probability;
+			probability *= mean / (n + 1);
+		}
+
+		expected[maxRepeated] = RandTest::birthdayTrials * rest;
+
+		result.birthday = RandTest::chiSquare(counts, expected);
+	}
+
+	// serial correlation of successive real numbers
+	{
+		std::vector<double> values(RandTest::reals);
+
+		for(auto& value : values)
+			value = rand.generateReal();
+
+		double sum = 0.;
+		double sumOfSquares = 0.;
+		double sumOfProducts = 0.;
+
+		for(std::size_t n = 0; n < values.size(); ++n) {
+			sum += values[n];
+			sumOfSquares += values[n] * values[n];
+			sumOfProducts += values[n] * values[(n + 1) % values.size()];
+		}
+
+		const double size = static_cast<double>(values.size());
+		const double correlation = (size * sumOfProducts - sum * sum) / (size * sumOfSquares - sum * sum);
+
+		result.serial = RandTest::normalP(correlation * std::sqrt(size));
+	}
+
+	// streaming test of pairs of bytes, doubling the length until it fails
+	{
+		std::vector<double> counts(65536, 0.);
+		std::vector<uint16_t> pairs(1 << 16);
+		std::size_t tested = 0;
+
+		result.pairs = 0;
+
+		for(unsigned int length = RandTest::minPairs; length <= RandTest::maxPairs; ++length) {
+			const std::size_t target = std::size_t{1} << length;
+
+			for(; tested < target; tested += pairs.size()) {
+				rand.generateBytes(reinterpret_cast<unsigned char *>(pairs.data()), pairs.size() * 2);
+
+				for(const auto pair : pairs)
+					++counts[pair];
+			}
+
+			const double p = RandTest::chiSquare(counts, std::vector<double>(65536, static_cast<double>(tested) / 65536));
+
+			if(p < 1e-6 || p > 1. - 1e-6)
+				break;
+
+			result.pairs = tested;
+		}
+	}
+
+	// throughput
+	rand.setByteLimits(0, 255);
+	rand.setIntLimits(-1000, 1000);
+	rand.setRealLimits(-1., 1.);
+
+	std::vector<unsigned char> bulkBytes(RandTest::iterations);
+	std::vector<int> bulkInts(RandTest::iterations);
+	std::vector<double> bulkReals(RandTest::iterations);
+
+	result.nsByte = this->measure([this, &rand]() {
+		for(std::size_t n = 0; n < RandTest::iterations; ++n)
+			this->sink = this->sink + rand.generateByte();
+	});
+
+	result.nsInt = this->measure([this, &rand]() {
+		for(std::size_t n = 0; n < RandTest::iterations; ++n)
+			this->sink = this->sink + rand.generateInt();
+	});
+
+	result.nsReal = this->measure([this, &rand]() {
+		for(std::size_t n = 0; n < RandTest::iterations; ++n)
+			this->sink = this->sink + rand.generateReal();
+	});
+
+	result.nsBytes = this->measure([this, &rand, &bulkBytes]() {
+		rand.generateBytes(bulkBytes.data(), bulkBytes.size());
+
+		this->sink = this->sink + bulkBytes.back();
+	});
+
+	result.nsInts = this->measure([this, &rand, &bulkInts]() {
+		rand.generateInts(bulkInts.data(), bulkInts.size());
+
+		this->sink = this->sink + bulkInts.back();
+	});
+
+	result.nsReals = this->measure([this, &rand, &bulkReals]() {
+		rand.generateReals(bulkReals.data(), bulkReals.size());
+
+		this->sink = this->sink + bulkReals.back();
+	});
+}
+
+// get the median time (in nanoseconds per value) of generating the values using the specified function
+template<typename Function> double RandTest::measure(Function function) {
+	std::vector<double> samples;
+
+	for(unsigned int n = 0; n < RandTest::repetitions; ++n) {
+		const auto begin = std::chrono::steady_clock::now();
+
+		function();
+
+		const auto end = std::chrono::steady_clock::now();
+
+		samples.push_back(std::chrono::duration<double, std::nano>(end - begin).count() / RandTest::iterations);
+	}
+
+	std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+
+	return samples[samples.size() / 2];
+}
+
+#endif /* RANDTEST_H_ */
@@ -0,0 +1,211 @@
+/*
+ * Recorder.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "Recorder.h"
+
+// constructors and destructor
+Recorder::Recorder() : width(0), height(0), frames(0), bytes(0) {}
+
+Recorder::Recorder(const std::string& fileName) : Recorder() {
+	this->open(fileName);
+}
+
+Recorder::~Recorder() {
+	this->close();
+}
+
+// create the specified file and start a new recording
+void Recorder::open(const std::string& fileName) {
+	this->close();
+
+	this->out.open(fileName, std::ios::binary | std::ios::trunc);
+
+	if(!(this->out))
+		throw std::runtime_error("Recorder::open(): could not create '" + fileName + "'");
+
+	FileHeader header{};
+
+	header.magic = Recorder::fileMagic;
+	header.version = Recorder::fileVersion;
+	header.tileSize = Recorder::tileSize;
+
+	this->out.write(reinterpret_cast<const char *>(&header), sizeof header);
+
+	this->width = 0;
+	this->height = 0;
+	this->frames = 0;
+	this->bytes = sizeof header;
+
+	this->differences.resize(Recorder::tileSize * Recorder::tileSize);
+}
+
+// finish the recording
+void Recorder::close() {
+	if(this->out.is_open())
+		this->out.close();
+
+	this->previous.clear();
+}
+
+// record the specified frame, which has been rendered at the specified time (in seconds)
+void Recorder::record(const Pixels& frame, double time) {
+	if(!(this->out.is_open()))
+		throw std::runtime_error("Recorder::record(): no recording has been started");
+
+	if(!frame || frame.getBytes() != 4)
+		throw std::runtime_error("Recorder::record(): only mapped pixels with four bytes per pixel are supported");
+
+	// start with an empty (i.e. zeroed) previous frame if the size has changed
+	if(frame.getWidth() != this->width || frame.getHeight() != this->height) {
+		this->width = frame.getWidth();
+		this->height = frame.getHeight();
+
+		this->previous.assign(static_cast<std::size_t>(this->width) * this->height, 0);
+	}
+
+	FrameHeader header{};
+
+	header.time = time;
+	header.width = this->width;
+	header.height = this->height;
+
+	this->buffer.clear();
+
+	// encode the changed tiles
+	const auto * pixels = static_cast<const uint32_t *>(frame.get());
+	const int tilesX = (this->width + Recorder::tileSize - 1) / Recorder::tileSize;
+	const int tilesY = (this->height + Recorder::tileSize - 1) / Recorder::tileSize;
+
+	for(int tileY = 0; tileY < tilesY; ++tileY)
+		for(int tileX = 0; tileX < tilesX; ++tileX) {
+			const std::size_t start = this->buffer.size();
+
+			// leave space for the index and the size of the tile
+			this->buffer.resize(start + 2 * sizeof(uint32_t));
+
+			const int x1 = tileX * Recorder::tileSize;
+			const int y1 = tileY * Recorder::tileSize;
+
+			if(
+					this->encodeTile(
+							pixels,
+							x1,
+							y1,
+							std::min(Recorder::tileSize, this->width - x1),
+							std::min(Recorder::tileSize, this->height - y1)
+					)
+			) {
+				const uint32_t tile[] = {
+						static_cast<uint32_t>(tileY * tilesX + tileX),
+						static_cast<uint32_t>(this->buffer.size() - start - 2 * sizeof(uint32_t))
+				};
+
+				std::memcpy(&(this->buffer[start]), tile, sizeof tile);
+
+				++(header.tiles);
+			}
+			else
+				this->buffer.resize(start);
+		}
+
+	header.size = this->buffer.size();
+
+	// write the frame
+	this->out.write(reinterpret_cast<const char *>(&header), sizeof header);
+	this->out.write(reinterpret_cast<const char *>(this->buffer.data()), this->buffer.size());
+
+	if(!(this->out))
+		throw std::runtime_error("Recorder::record(): could not write frame #" + std::to_string(this->frames));
+
+	++(this->frames);
+
+	this->bytes += sizeof header + this->buffer.size();
+}
+
+// get the number of recorded frames
+std::size_t Recorder::getFrames() const {
+	return this->frames;
+}
+
+// get the number of bytes written so far
+std::size_t Recorder::getBytes() const {
+	return this->bytes;
+}
+
+// get whether a recording has been started
+Recorder::operator bool() const {
+	return this->out.is_open();
+}
+
+// encode the differences of one tile (x1, y1, w, h) to the previous frame, return whether there have been any
+bool Recorder::encodeTile(const uint32_t * frame, int x1, int y1, int w, int h) {
+	const std::size_t n = static_cast<std::size_t>(w) * h;
+	uint32_t * differences = this->differences.data();
+	uint32_t any = 0;
+
+	// XOR the tile with the previous frame
+	for(int y = 0; y < h; ++y) {
+		const std::size_t offset = static_cast<std::size_t>(y1 + y) * this->width + x1;
+		const uint32_t * from = frame + offset;
+		const uint32_t * last = this->previous.data() + offset;
+		uint32_t * to = differences + y * w;
+
+		for(int x = 0; x < w; ++x) {
+			to[x] = from[x] ^ last[x];
+			any |= to[x];
+		}
+	}
+
+	if(!any)
+		return false;
+
+	// update the previous frame
+	for(int y = 0; y < h; ++y) {
+		const std::size_t offset = static_cast<std::size_t>(y1 + y) * this->width + x1;
+
+		std::memcpy(this->previous.data() + offset, frame + offset, w * sizeof *frame);
+	}
+
+	// encode runs of unchanged and changed pixels (including single unchanged pixels between changed ones)
+	std::size_t i = 0;
+
+	while(i < n) {
+		std::size_t count = 0;
+		uint16_t run = 0;
+
+		if(differences[i]) {
+			while(
+					i + count < n
+					&& count < Recorder::runMax
+					&& (differences[i + count] || (i + count + 1 < n && differences[i + count + 1]))
+			)
+				++count;
+
+			run = Recorder::runChanged | static_cast<uint16_t>(count);
+		}
+		else {
+			while(i + count < n && count < Recorder::runMax && !differences[i + count])
+				++count;
+
+			run = static_cast<uint16_t>(count);
+		}
+
+		const std::size_t end = this->buffer.size();
+		const std::size_t size = (run & Recorder::runChanged) ? count * sizeof *differences : 0;
+
+		this->buffer.resize(end + sizeof run + size);
+
+		std::memcpy(&(this->buffer[end]), &run, sizeof run);
+
+		if(size)
+			std::memcpy(&(this->buffer[end + sizeof run]), differences + i, size);
+
+		i += count;
+	}
+
+	return true;
+}
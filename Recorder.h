@@ -0,0 +1,90 @@
+/*
+ * Recorder.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef RECORDER_H_
+#define RECORDER_H_
+
+#pragma once
+
+#include <algorithm>	// std::min
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint16_t, uint32_t
+#include <cstring>		// std::memcpy
+#include <fstream>		// std::ofstream
+#include <stdexcept>	// std::runtime_error
+#include <string>		// std::string
+#include <vector>		// std::vector
+
+#include "Pixels.h"
+
+// recorder writing every finished frame into a file as the compressed difference to the previous frame
+//	NOTE:	Every frame will be XOR-ed with the previous one, tiles without changes will be skipped and
+//			the remaining tiles will be compressed using run-length encoding of unchanged and changed pixels.
+//			Use Replayer to play the recording back.
+class Recorder {
+public:
+	// size of the tiles (in physical pixels)
+	static constexpr int tileSize = 32;
+
+	// header of a recording
+	struct FileHeader {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t tileSize;
+		uint32_t reserved;
+	};
+
+	// header of a recorded frame, followed by its changed tiles
+	//	NOTE:	Each tile consists of its index and the size of its data (as 32-bit integers), followed by the runs
+	//			of its pixels (in rows). Each run starts with a 16-bit header containing the number of pixels,
+	//			with the highest bit set if the run consists of changed pixels, which will follow as 32-bit XOR values.
+	struct FrameHeader {
+		double time;
+		uint32_t width;
+		uint32_t height;
+		uint32_t tiles;
+		uint32_t size;
+	};
+
+	static constexpr uint32_t fileMagic = 0x52584950;	// "PIXR"
+	static constexpr uint32_t fileVersion = 1;
+	static constexpr uint16_t runChanged = 0x8000;
+	static constexpr uint16_t runMax = 0x7fff;
+
+	Recorder();
+	Recorder(const std::string& fileName);
+	virtual ~Recorder();
+
+	void open(const std::string& fileName);
+	void close();
+
+	void record(const Pixels& frame, double time);
+
+	std::size_t getFrames() const;
+	std::size_t getBytes() const;
+
+	operator bool() const;
+
+	Recorder(const Recorder&) = delete;
+	Recorder& operator=(const Recorder&) = delete;
+
+private:
+	bool encodeTile(const uint32_t * frame, int x1, int y1, int w, int h);
+
+	std::ofstream out;
+
+	int width;
+	int height;
+	std::vector<uint32_t> previous;
+	std::vector<uint32_t> differences;
+	std::vector<unsigned char> buffer;
+
+	std::size_t frames;
+	std::size_t bytes;
+};
+
+#endif /* RECORDER_H_ */
@@ -0,0 +1,239 @@
+/*
+ * Replayer.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "Replayer.h"
+
+// constructors and destructor
+Replayer::Replayer() : tileSize(0), time(0.), firstTime(0.), frames(0), finished(false), realTime(false) {}
+
+Replayer::Replayer(const std::string& fileName) : Replayer() {
+	this->open(fileName);
+}
+
+Replayer::~Replayer() {
+	this->close();
+}
+
+// open the specified recording
+void Replayer::open(const std::string& fileName) {
+	this->close();
+
+	this->in.open(fileName, std::ios::binary);
+
+	if(!(this->in))
+		throw std::runtime_error("Replayer::open(): could not open '" + fileName + "'");
+
+	Recorder::FileHeader header{};
+
+	if(
+			!(this->in.read(reinterpret_cast<char *>(&header), sizeof header))
+			|| header.magic != Recorder::fileMagic
+			|| header.version != Recorder::fileVersion
+			|| !header.tileSize
+			|| header.tileSize > 4096
+	) {
+		this->in.close();
+
+		throw std::runtime_error("Replayer::open(): '" + fileName + "' is not a valid recording");
+	}
+
+	this->fileName = fileName;
+	this->tileSize = header.tileSize;
+}
+
+// close the recording
+void Replayer::close() {
+	if(this->in.is_open())
+		this->in.close();
+
+	this->frame.deallocate();
+
+	this->time = 0.;
+	this->firstTime = 0.;
+	this->frames = 0;
+	this->finished = false;
+}
+
+// restart the recording from its first frame
+void Replayer::rewind() {
+	if(!(this->fileName.empty()))
+		this->open(this->fileName);
+}
+
+// set whether to replay the frames at their original times (otherwise they will be replayed as fast as possible)
+void Replayer::setRealTime(bool realTime) {
+	this->realTime = realTime;
+}
+
+// read the next frame, return whether there has been one
+//	NOTE:	When replaying in real time, this will wait until the frame is due.
+bool Replayer::next() {
+	if(!(this->in.is_open()) || this->finished)
+		return false;
+
+	Recorder::FrameHeader header{};
+
+	if(!(this->in.read(reinterpret_cast<char *>(&header), sizeof header))) {
+		this->finished = true;
+
+		return false;
+	}
+
+	// start with an empty (i.e. zeroed) frame if the size has changed
+	if(
+			!(this->frame)
+			|| static_cast<int>(header.width) != this->frame.getWidth()
+			|| static_cast<int>(header.height) != this->frame.getHeight()
+	) {
+		if(!header.width || !header.height || header.width > 65536 || header.height > 65536)
+			throw std::runtime_error("Replayer::next(): invalid size of frame #" + std::to_string(this->frames));
+
+		this->frame.allocate(header.width, header.height, 4, Memory::HUGE_PAGES_NONE);
+		this->frame.fill(0, 0, 0, 0);
+	}
+
+	// read and decode the changed tiles
+	this->buffer.resize(header.size);
+
+	if(!(this->in.read(reinterpret_cast<char *>(this->buffer.data()), header.size)))
+		throw std::runtime_error("Replayer::next(): truncated frame #" + std::to_string(this->frames));
+
+	std::size_t offset = 0;
+
+	for(uint32_t n = 0; n < header.tiles; ++n) {
+		uint32_t tile[2];
+
+		if(offset + sizeof tile > this->buffer.size())
+			throw std::runtime_error("Replayer::next(): truncated frame #" + std::to_string(this->frames));
+
+		std::memcpy(tile, &(this->buffer[offset]), sizeof tile);
+
+		offset += sizeof tile;
+
+		if(tile[1] > this->buffer.size() - offset)
+			throw std::runtime_error("Replayer::next(): truncated frame #" + std::to_string(this->frames));
+
+		this->decodeTile(tile[0], &(this->buffer[offset]), tile[1]);
+
+		offset += tile[1];
+	}
+
+	// wait until the frame is due if necessary
+	if(!(this->frames)) {
+		this->firstTime = header.time;
+		this->start = std::chrono::steady_clock::now();
+	}
+	else if(this->realTime)
+		std::this_thread::sleep_until(
+				this->start
+				+ std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+						std::chrono::duration<double>(header.time - this->firstTime)
+				)
+		);
+
+	this->time = header.time;
+
+	++(this->frames);
+
+	return true;
+}
+
+// get the current frame
+const Pixels& Replayer::getFrame() const {
+	return this->frame;
+}
+
+// get the time at which the current frame has been recorded (in seconds)
+double Replayer::getTime() const {
+	return this->time;
+}
+
+// get the number of frames replayed so far
+std::size_t Replayer::getFrames() const {
+	return this->frames;
+}
+
+// get whether the end of the recording has been reached
+bool Replayer::isFinished() const {
+	return this->finished;
+}
+
+// get whether a recording has been opened
+Replayer::operator bool() const {
+	return this->in.is_open();
+}
+
+// apply the changes of one tile with the specified index to the current frame
+void Replayer::decodeTile(uint32_t index, const unsigned char * data, std::size_t size) {
+	const int width = this->frame.getWidth();
+	const int height = this->frame.getHeight();
+	const uint32_t tilesX = (width + this->tileSize - 1) / this->tileSize;
+	const uint32_t tilesY = (height + this->tileSize - 1) / this->tileSize;
+
+	if(index >= tilesX * tilesY)
+		throw std::runtime_error("Replayer::decodeTile(): invalid tile #" + std::to_string(index));
+
+	const int x1 = (index % tilesX) * this->tileSize;
+	const int y1 = (index / tilesX) * this->tileSize;
+	const std::size_t w = std::min(this->tileSize, width - x1);
+	const std::size_t h = std::min(this->tileSize, height - y1);
+	const std::size_t n = w * h;
+
+	auto * pixels = static_cast<uint32_t *>(this->frame.get());
+	std::size_t offset = 0;
+	std::size_t pixel = 0;
+
+	while(offset < size) {
+		uint16_t run = 0;
+
+		if(offset + sizeof run > size)
+			throw std::runtime_error("Replayer::decodeTile(): truncated tile");
+
+		std::memcpy(&run, data + offset, sizeof run);
+
+		offset += sizeof run;
+
+		const std::size_t count = run & Recorder::runMax;
+
+		if(pixel + count > n)
+			throw std::runtime_error("Replayer::decodeTile(): invalid run");
+
+		if(!(run & Recorder::runChanged)) {
+			pixel += count;
+
+			continue;
+		}
+
+		if(offset + count * sizeof *pixels > size)
+			throw std::runtime_error("Replayer::decodeTile(): truncated tile");
+
+		// apply the changes (row by row)
+		const unsigned char * changes = data + offset;
+		std::size_t left = count;
+
+		while(left) {
+			const std::size_t x = pixel % w;
+			const std::size_t y = pixel / w;
+			const std::size_t segment = std::min(left, w - x);
+			uint32_t * to = pixels + (y1 + y) * width + x1 + x;
+
+			for(std::size_t i = 0; i < segment; ++i) {
+				uint32_t value = 0;
+
+				std::memcpy(&value, changes + i * sizeof value, sizeof value);
+
+				to[i] ^= value;
+			}
+
+			changes += segment * sizeof *pixels;
+			pixel += segment;
+			left -= segment;
+		}
+
+		offset += count * sizeof *pixels;
+	}
+}
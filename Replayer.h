@@ -0,0 +1,71 @@
+/*
+ * Replayer.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef REPLAYER_H_
+#define REPLAYER_H_
+
+#pragma once
+
+#include <algorithm>	// std::min
+#include <chrono>		// std::chrono
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint16_t, uint32_t
+#include <cstring>		// std::memcpy
+#include <fstream>		// std::ifstream
+#include <stdexcept>	// std::runtime_error
+#include <string>		// std::string, std::to_string
+#include <thread>		// std::this_thread
+#include <vector>		// std::vector
+
+#include "Pixels.h"
+#include "Recorder.h"
+
+// replayer reading the frames of a recording (see Recorder) one by one, either headless or into the main window
+class Replayer {
+public:
+	Replayer();
+	Replayer(const std::string& fileName);
+	virtual ~Replayer();
+
+	void open(const std::string& fileName);
+	void close();
+	void rewind();
+
+	void setRealTime(bool realTime);
+
+	bool next();
+
+	const Pixels& getFrame() const;
+	double getTime() const;
+	std::size_t getFrames() const;
+	bool isFinished() const;
+
+	operator bool() const;
+
+	Replayer(const Replayer&) = delete;
+	Replayer& operator=(const Replayer&) = delete;
+
+private:
+	void decodeTile(uint32_t index, const unsigned char * data, std::size_t size);
+
+	std::ifstream in;
+	std::string fileName;
+
+	int tileSize;
+	Pixels frame;
+	std::vector<unsigned char> buffer;
+
+	double time;
+	double firstTime;
+	std::size_t frames;
+	bool finished;
+
+	bool realTime;
+	std::chrono::steady_clock::time_point start;
+};
+
+#endif /* REPLAYER_H_ */
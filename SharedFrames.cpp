@@ -0,0 +1,245 @@
+/*
+ * SharedFrames.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "SharedFrames.h"
+
+// constructor setting the name of the shared memory (starting with a slash) and the number of slots in the ring
+//	NOTE:	The shared memory will be created with the first frames (see SharedFrames::create).
+SharedFrames::SharedFrames(const std::string& name, unsigned int slots)
+		: name(name),
+		  slots(slots),
+		  fd(-1),
+		  mapped(nullptr),
+		  mappedSize(0),
+		  width(0),
+		  height(0),
+		  frames(0),
+		  writing(false),
+		  previous(false) {
+	if(this->slots < 2)
+		throw std::runtime_error("SharedFrames::SharedFrames(): at least two slots are needed");
+}
+
+// destructor removing the shared memory
+SharedFrames::~SharedFrames() {
+	this->destroy();
+}
+
+// create the shared memory or change its layout for frames with the specified width (w) and height (h)
+void SharedFrames::create(int w, int h) {
+	if(this->mapped && w == this->width && h == this->height)
+		return;
+
+	if(w <= 0 || h <= 0)
+		throw std::runtime_error("SharedFrames::create(): invalid frame size");
+
+	if(this->writing)
+		throw std::runtime_error("SharedFrames::create(): a frame is being written");
+
+	// the atomics need to be lock-free to be shared with other processes
+	if(!(std::atomic<uint32_t>().is_lock_free()) || !(std::atomic<uint64_t>().is_lock_free()))
+		throw std::runtime_error("SharedFrames::create(): lock-free atomics are not supported");
+
+	if(this->fd < 0) {
+		this->fd = shm_open(this->name.c_str(), O_CREAT | O_RDWR, 0600);
+
+		if(this->fd < 0)
+			throw std::runtime_error("SharedFrames::create(): could not create shared memory '" + this->name + "'");
+	}
+
+	const std::size_t slotSize = SharedFrames::getSlotSize(w, h);
+	const std::size_t size = SharedFrames::headerSize + this->slots * slotSize;
+
+	uint32_t layout = 0;
+
+	if(this->mapped) {
+		auto * header = static_cast<Header *>(this->mapped);
+
+		// lock the layout while it is being changed
+		layout = header->layout.load(std::memory_order_relaxed) + 1;
+
+		header->layout.store(layout, std::memory_order_relaxed);
+		header->latest.store(0, std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_release);
+	}
+	else
+		layout = 1;
+
+	// grow (but never shrink) the shared memory, so that readers can still access their (smaller) mapping
+	if(size > this->mappedSize) {
+		if(this->mapped)
+			munmap(this->mapped, this->mappedSize);
+
+		this->mapped = nullptr;
+
+		if(ftruncate(this->fd, size))
+			throw std::runtime_error("SharedFrames::create(): could not resize shared memory '" + this->name + "'");
+
+		void * pointer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, this->fd, 0);
+
+		if(pointer == MAP_FAILED)
+			throw std::runtime_error("SharedFrames::create(): could not map shared memory '" + this->name + "'");
+
+		this->mapped = pointer;
+		this->mappedSize = size;
+	}
+
+	// (re-)initialize the header and the slots
+	auto * header = static_cast<Header *>(this->mapped);
+
+	if(layout == 1)
+		new(header) Header();
+
+	header->layout.store(layout, std::memory_order_relaxed);
+	header->magic = SharedFrames::sharedMagic;
+	header->version = SharedFrames::sharedVersion;
+	header->slots = this->slots;
+	header->width = w;
+	header->height = h;
+	header->slotSize = slotSize;
+	header->size = this->mappedSize;
+	header->latest.store(0, std::memory_order_relaxed);
+
+	this->width = w;
+	this->height = h;
+
+	for(uint64_t n = 0; n < this->slots; ++n)
+		new(this->getSlot(n)) Slot();
+
+	this->previous = false;
+
+	// unlock the layout
+	header->layout.store(layout + 1, std::memory_order_release);
+}
+
+// remove the shared memory
+void SharedFrames::destroy() {
+	if(this->mapped) {
+		munmap(this->mapped, this->mappedSize);
+
+		this->mapped = nullptr;
+		this->mappedSize = 0;
+	}
+
+	if(this->fd >= 0) {
+		close(this->fd);
+		shm_unlink(this->name.c_str());
+
+		this->fd = -1;
+	}
+
+	this->width = 0;
+	this->height = 0;
+	this->writing = false;
+	this->previous = false;
+}
+
+// get the width of the frames
+int SharedFrames::getWidth() const {
+	return this->width;
+}
+
+// get the height of the frames
+int SharedFrames::getHeight() const {
+	return this->height;
+}
+
+// start writing the next frame and get a pointer to its pixels,
+//	optionally keeping the content of the last frame (otherwise its content is undefined)
+//	NOTE:	A new frame will be black if there has been no previous one since the layout has been (re-)created.
+//			Keeping the content copies the whole last frame into the next slot, because readers might still access the last one.
+unsigned char * SharedFrames::begin(bool keep) {
+	if(!(this->mapped))
+		throw std::runtime_error("SharedFrames::begin(): shared memory has not been created");
+
+	if(this->writing)
+		throw std::runtime_error("SharedFrames::begin(): a frame is already being written");
+
+	auto * slot = this->getSlot(this->frames);
+
+	// lock the slot
+	slot->sequence.store(slot->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+
+	std::atomic_thread_fence(std::memory_order_release);
+
+	slot->width = this->width;
+	slot->height = this->height;
+	slot->frame = this->frames;
+
+	auto * data = reinterpret_cast<unsigned char *>(slot + 1);
+	const std::size_t count = static_cast<std::size_t>(this->width) * this->height;
+
+	if(!(this->previous))
+		std::fill_n(reinterpret_cast<uint32_t *>(data), count, Pixels::pack(0, 0, 0));
+	else if(keep)
+		std::memcpy(data, this->getSlot(this->frames - 1) + 1, count * 4);
+
+	this->writing = true;
+
+	return data;
+}
+
+// finish writing the current frame, which has been rendered at the specified time (in seconds), and publish it
+void SharedFrames::end(double time) {
+	if(!(this->writing))
+		return;
+
+	auto * slot = this->getSlot(this->frames);
+
+	slot->time = time;
+
+	// unlock the slot and publish the frame
+	slot->sequence.store(slot->sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+
+	++(this->frames);
+
+	static_cast<Header *>(this->mapped)->latest.store(this->frames, std::memory_order_release);
+
+	this->writing = false;
+	this->previous = true;
+}
+
+// copy the specified frame, which has been rendered at the specified time (in seconds), into the next slot and publish it
+void SharedFrames::write(const Pixels& frame, double time) {
+	if(!frame || frame.getBytes() != 4)
+		throw std::runtime_error("SharedFrames::write(): only mapped pixels with four bytes per pixel are supported");
+
+	this->create(frame.getWidth(), frame.getHeight());
+
+	std::memcpy(this->begin(false), frame.get(), static_cast<std::size_t>(this->width) * this->height * 4);
+
+	this->end(time);
+}
+
+// get the name of the shared memory
+const std::string& SharedFrames::getName() const {
+	return this->name;
+}
+
+// get the number of frames written so far
+uint64_t SharedFrames::getFrames() const {
+	return this->frames;
+}
+
+// get the size of one slot for frames with the specified width (w) and height (h), including its header
+std::size_t SharedFrames::getSlotSize(int w, int h) {
+	constexpr std::size_t pageSize = 4096;
+
+	const std::size_t size = sizeof(Slot) + static_cast<std::size_t>(w) * h * 4;
+
+	return (size + pageSize - 1) / pageSize * pageSize;
+}
+
+// get the slot for the specified frame
+SharedFrames::Slot * SharedFrames::getSlot(uint64_t frame) {
+	return reinterpret_cast<Slot *>(
+			static_cast<unsigned char *>(this->mapped)
+			+ SharedFrames::headerSize
+			+ (frame % this->slots) * SharedFrames::getSlotSize(this->width, this->height)
+	);
+}
@@ -0,0 +1,103 @@
+/*
+ * SharedFrames.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef SHAREDFRAMES_H_
+#define SHAREDFRAMES_H_
+
+#pragma once
+
+#include <fcntl.h>		// O_CREAT, O_RDWR
+#include <sys/mman.h>	// mmap, munmap, shm_open, shm_unlink, MAP_FAILED, MAP_SHARED, PROT_READ, PROT_WRITE
+#include <unistd.h>		// close, ftruncate
+
+#include <algorithm>	// std::fill_n
+#include <atomic>		// std::atomic, std::atomic_thread_fence, std::memory_order
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint32_t, uint64_t
+#include <cstring>		// std::memcpy
+#include <new>			// placement new
+#include <stdexcept>	// std::runtime_error
+#include <string>		// std::string
+
+#include "Pixels.h"
+
+// ring of frames in POSIX shared memory, to be read by other (local) processes without sending them through sockets or pipes
+//	NOTE:	Every slot is protected by a sequence lock, i.e. its sequence number is odd while the frame is being written.
+//			The shared memory will be resized when the size of the frames changes (see SharedFramesReader).
+class SharedFrames {
+public:
+	// header at the beginning of the shared memory
+	struct Header {
+		uint32_t magic;
+		uint32_t version;
+		std::atomic<uint32_t> layout;		// sequence lock for the layout (odd while it is being changed)
+		uint32_t slots;
+		uint32_t width;
+		uint32_t height;
+		uint64_t slotSize;
+		uint64_t size;						// size of the whole shared memory (it will never shrink)
+		std::atomic<uint64_t> latest;		// number of the latest frame plus one (zero if there is none yet)
+		unsigned char padding[16];
+	};
+
+	// header at the beginning of each slot, followed by the pixels (in RGBA, bottom-up)
+	struct Slot {
+		std::atomic<uint32_t> sequence;		// sequence lock (odd while the frame is being written)
+		uint32_t width;
+		uint32_t height;
+		uint32_t reserved;
+		uint64_t frame;
+		double time;
+		unsigned char padding[32];
+	};
+
+	static_assert(sizeof(Header) == 64, "SharedFrames::Header needs to be aligned to a cache line");
+	static_assert(sizeof(Slot) == 64, "SharedFrames::Slot needs to be aligned to a cache line");
+
+	static constexpr uint32_t sharedMagic = 0x53584950;	// "PIXS"
+	static constexpr uint32_t sharedVersion = 1;
+	static constexpr std::size_t headerSize = 4096;
+
+	SharedFrames(const std::string& name, unsigned int slots = 3);
+	virtual ~SharedFrames();
+
+	void create(int w, int h);
+	void destroy();
+
+	int getWidth() const;
+	int getHeight() const;
+
+	unsigned char * begin(bool keep);
+	void end(double time);
+	void write(const Pixels& frame, double time);
+
+	const std::string& getName() const;
+	uint64_t getFrames() const;
+
+	SharedFrames(const SharedFrames&) = delete;
+	SharedFrames& operator=(const SharedFrames&) = delete;
+
+	static std::size_t getSlotSize(int w, int h);
+
+private:
+	Slot * getSlot(uint64_t frame);
+
+	std::string name;
+	unsigned int slots;
+
+	int fd;
+	void * mapped;
+	std::size_t mappedSize;
+	int width;
+	int height;
+
+	uint64_t frames;
+	bool writing;
+	bool previous;
+};
+
+#endif /* SHAREDFRAMES_H_ */
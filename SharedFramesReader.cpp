@@ -0,0 +1,204 @@
+/*
+ * SharedFramesReader.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "SharedFramesReader.h"
+
+// constructors and destructor
+SharedFramesReader::SharedFramesReader() : fd(-1), mapped(nullptr), mappedSize(0), latest(0), time(0.) {}
+
+SharedFramesReader::SharedFramesReader(const std::string& name) : SharedFramesReader() {
+	this->open(name);
+}
+
+SharedFramesReader::~SharedFramesReader() {
+	this->close();
+}
+
+// open the shared memory with the specified name (starting with a slash) created by SharedFrames
+void SharedFramesReader::open(const std::string& name) {
+	this->close();
+
+	this->fd = shm_open(name.c_str(), O_RDONLY, 0);
+
+	if(this->fd < 0)
+		throw std::runtime_error("SharedFramesReader::open(): could not open shared memory '" + name + "'");
+
+	this->name = name;
+
+	this->map();
+
+	const auto * header = static_cast<const SharedFrames::Header *>(this->mapped);
+
+	if(header->magic != SharedFrames::sharedMagic || header->version != SharedFrames::sharedVersion) {
+		this->close();
+
+		throw std::runtime_error("SharedFramesReader::open(): invalid or unsupported shared memory '" + name + "'");
+	}
+}
+
+// close the shared memory
+void SharedFramesReader::close() {
+	if(this->mapped) {
+		munmap(const_cast<void *>(this->mapped), this->mappedSize);
+
+		this->mapped = nullptr;
+		this->mappedSize = 0;
+	}
+
+	if(this->fd >= 0) {
+		::close(this->fd);
+
+		this->fd = -1;
+	}
+
+	this->frame.deallocate();
+
+	this->latest = 0;
+	this->time = 0.;
+}
+
+// copy the latest frame if it has not been read yet, return whether a new frame has been read
+//	NOTE:	Returns false, too, if no consistent frame could be read, because the writer kept overwriting it.
+bool SharedFramesReader::read() {
+	if(!(this->mapped))
+		throw std::runtime_error("SharedFramesReader::read(): no shared memory has been opened");
+
+	for(int attempt = 0; attempt < SharedFramesReader::maxAttempts; ++attempt) {
+		if(attempt)
+			std::this_thread::yield();
+
+		const auto * header = static_cast<const SharedFrames::Header *>(this->mapped);
+		const uint32_t layout = header->layout.load(std::memory_order_acquire);
+
+		// wait for changes of the layout to finish
+		if(layout & 1)
+			continue;
+
+		// read the layout once (it might be changed by the writer at any time)
+		const uint64_t size = header->size;
+		const uint64_t slots = header->slots;
+		const uint64_t slotSize = header->slotSize;
+		const uint64_t width = header->width;
+		const uint64_t height = header->height;
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if(header->layout.load(std::memory_order_relaxed) != layout)
+			continue;
+
+		// re-map the shared memory if it has grown
+		if(size > this->mappedSize) {
+			this->map();
+
+			continue;
+		}
+
+		// check the layout against the mapping before accessing any slot
+		if(
+				!slots
+				|| !width
+				|| !height
+				|| slotSize > this->mappedSize
+				|| slots > (this->mappedSize - SharedFrames::headerSize) / slotSize
+				|| width > 65536
+				|| height > 65536
+				|| sizeof(SharedFrames::Slot) + width * height * 4 > slotSize
+		)
+			continue;
+
+		// get the latest frame
+		const uint64_t latest = header->latest.load(std::memory_order_acquire);
+
+		if(!latest || latest == this->latest)
+			return false;
+
+		const uint64_t number = latest - 1;
+		const auto * slot = reinterpret_cast<const SharedFrames::Slot *>(
+				static_cast<const unsigned char *>(this->mapped)
+				+ SharedFrames::headerSize
+				+ (number % slots) * slotSize
+		);
+
+		const uint32_t sequence = slot->sequence.load(std::memory_order_acquire);
+
+		// skip frames that are being written or have already been overwritten
+		if((sequence & 1) || slot->frame != number)
+			continue;
+
+		const int w = slot->width;
+		const int h = slot->height;
+
+		if(static_cast<uint64_t>(w) != width || static_cast<uint64_t>(h) != height)
+			continue;
+
+		// copy the frame
+		if(this->frame.getWidth() != w || this->frame.getHeight() != h || !(this->frame))
+			this->frame.allocate(w, h, 4);
+
+		std::memcpy(this->frame.get(), slot + 1, static_cast<std::size_t>(w) * h * 4);
+
+		const double time = slot->time;
+
+		// check whether the frame has been changed while copying it
+		std::atomic_thread_fence(std::memory_order_acquire);
+
+		if(
+				slot->sequence.load(std::memory_order_relaxed) != sequence
+				|| header->layout.load(std::memory_order_relaxed) != layout
+		)
+			continue;
+
+		this->latest = latest;
+		this->time = time;
+
+		return true;
+	}
+
+	return false;
+}
+
+// get the last frame that has been read
+const Pixels& SharedFramesReader::getFrame() const {
+	return this->frame;
+}
+
+// get the number of the last frame that has been read (counted by the writer, starting with zero)
+uint64_t SharedFramesReader::getFrameNumber() const {
+	return this->latest ? this->latest - 1 : 0;
+}
+
+// get the time (in seconds) at which the last frame that has been read has been rendered
+double SharedFramesReader::getTime() const {
+	return this->time;
+}
+
+// get whether the shared memory has been opened
+SharedFramesReader::operator bool() const {
+	return this->mapped != nullptr;
+}
+
+// map the whole shared memory (again)
+void SharedFramesReader::map() {
+	struct stat status{};
+
+	if(fstat(this->fd, &status) || static_cast<std::size_t>(status.st_size) < SharedFrames::headerSize)
+		throw std::runtime_error("SharedFramesReader::map(): invalid shared memory '" + this->name + "'");
+
+	if(this->mapped)
+		munmap(const_cast<void *>(this->mapped), this->mappedSize);
+
+	this->mapped = nullptr;
+	this->mappedSize = 0;
+
+	void * pointer = mmap(nullptr, status.st_size, PROT_READ, MAP_SHARED, this->fd, 0);
+
+	if(pointer == MAP_FAILED)
+		throw std::runtime_error("SharedFramesReader::map(): could not map shared memory '" + this->name + "'");
+
+	this->mapped = pointer;
+	this->mappedSize = status.st_size;
+}
@@ -0,0 +1,66 @@
+/*
+ * SharedFramesReader.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef SHAREDFRAMESREADER_H_
+#define SHAREDFRAMESREADER_H_
+
+#pragma once
+
+#include <fcntl.h>		// O_RDONLY
+#include <sys/mman.h>	// mmap, munmap, shm_open, MAP_FAILED, MAP_SHARED, PROT_READ
+#include <sys/stat.h>	// fstat, struct stat
+#include <unistd.h>		// close
+
+#include <atomic>		// std::atomic_thread_fence, std::memory_order
+#include <cstddef>		// std::size_t
+#include <cstdint>		// uint32_t, uint64_t
+#include <cstring>		// std::memcpy
+#include <stdexcept>	// std::runtime_error
+#include <string>		// std::string
+#include <thread>		// std::this_thread
+
+#include "Pixels.h"
+#include "SharedFrames.h"
+
+// reader copying the latest consistent frame from a ring in shared memory written by another process (see SharedFrames)
+class SharedFramesReader {
+public:
+	// maximum number of attempts to read a frame that is not being written at the same time
+	static constexpr int maxAttempts = 64;
+
+	SharedFramesReader();
+	SharedFramesReader(const std::string& name);
+	virtual ~SharedFramesReader();
+
+	void open(const std::string& name);
+	void close();
+
+	bool read();
+
+	const Pixels& getFrame() const;
+	uint64_t getFrameNumber() const;
+	double getTime() const;
+
+	operator bool() const;
+
+	SharedFramesReader(const SharedFramesReader&) = delete;
+	SharedFramesReader& operator=(const SharedFramesReader&) = delete;
+
+private:
+	void map();
+
+	std::string name;
+	int fd;
+	const void * mapped;
+	std::size_t mappedSize;
+
+	Pixels frame;
+	uint64_t latest;
+	double time;
+};
+
+#endif /* SHAREDFRAMESREADER_H_ */
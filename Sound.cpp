@@ -7,12 +7,15 @@
 
 #include "Sound.h"
 
-// constructor initializing the libsoundio library
+// constructor initializing the libsoundio library asynchronously
+//	NOTE:	Connecting to the backend will overlap with the initialization of the caller (e.g. creating the window),
+//			functions that need the connection will wait for it and re-throw any exception that occured while connecting.
 Sound::Sound()
 		: started(false),
 		  connected(false),
 		  initialized(false),
 		  running(false),
+		  failed(false),
 		  secondsOffset(0.),
 		  secondsPerFrame(0.),
 		  soundIo(nullptr),
@@ -25,7 +28,46 @@ Sound::Sound()
 		  outputMaxFrames(0),
 		  outputLatency(0.025),
 		  isUnderflow(false),
-		  lastWritingError(0) {
+		  lastWritingError(0),
+		  firstSample(0),
+		  callbackThread(),
+		  isCallbackThreadKnown(false),
+		  isThreadConfigured(false),
+		  isThreadConfigReported(false),
+		  metricCallbackTime(nullptr),
+		  metricFrames(nullptr),
+		  metricUnderflows(nullptr) {
+	this->connection = std::async(std::launch::async, &Sound::connect, this).share();
+}
+
+// destructor
+Sound::~Sound() {
+	// wait for the connection to finish (ignoring any errors)
+	if(this->connection.valid())
+		this->connection.wait();
+
+	// stop the thread
+	this->stop();
+
+	// clear thread-related stuff (e.g. if the thread has been terminated by an exception)
+	this->threadClear();
+
+	// disconnect from the backend and destroy the soundio context
+	if(this->soundIo) {
+		if(this->connected) {
+			soundio_disconnect(this->soundIo);
+
+			this->connected = false;
+		}
+
+		soundio_destroy(this->soundIo);
+
+		this->soundIo = nullptr;
+	}
+}
+
+// connect to the backend and select the default output device (in an extra thread)
+void Sound::connect() {
 	// create soundio context
 	this->soundIo = soundio_create();
 
@@ -54,33 +96,19 @@ Sound::Sound()
 		throw std::runtime_error("soundio_default_output_device_index failed");
 
 	// use the default output device for now
-	this->setOutputDevice(this->defaultOutputDeviceIndex);
+	//	NOTE:	The sound thread might already wait for the connection, i.e. it must not be restarted here.
+	this->selectOutputDevice(this->defaultOutputDeviceIndex);
 }
 
-// destructor
-Sound::~Sound() {
-	// stop the thread
-	this->stop();
-
-	// clear thread-related stuff (e.g. if the thread has been terminated by an exception)
-	this->threadClear();
-
-	// disconnect from the backend and destroy the soundio context
-	if(this->soundIo) {
-		if(this->connected) {
-			soundio_disconnect(this->soundIo);
-
-			this->connected = false;
-		}
-
-		soundio_destroy(this->soundIo);
-
-		this->soundIo = nullptr;
-	}
+// wait until the connection to the backend has been established, re-throwing any exception that occured while connecting
+void Sound::waitForConnection() const {
+	this->connection.get();
 }
 
 // write all available output devices into a vector and return it
 std::vector<Sound::Device> Sound::listOutputDevices() const {
+	this->waitForConnection();
+
 	// check context and state
 	if(!(this->soundIo))
 		throw std::runtime_error("listDevices(): soundio not initialized");
@@ -119,11 +147,15 @@ std::vector<Sound::Device> Sound::listOutputDevices() const {
 
 // get the index of the default output device or -1 if none is available
 int Sound::getDefaultOutputDeviceIndex() const {
+	this->waitForConnection();
+
 	return this->defaultOutputDeviceIndex;
 }
 
 // get the ID of the currently selected device (e.g. for saving it into a settings file)
 std::string Sound::getOutputDeviceId() const {
+	this->waitForConnection();
+
 	if(this->outputDeviceId.empty())
 		throw std::runtime_error("No device selected");
 
@@ -132,11 +164,15 @@ std::string Sound::getOutputDeviceId() const {
 
 // get the name of the currently selected device
 std::string Sound::getOutputDeviceName() const {
+	this->waitForConnection();
+
 	return this->outputDeviceName;
 }
 
 // get the name of the underlying backend used for communicating with the sound device(s)
 std::string Sound::getBackend() const {
+	this->waitForConnection();
+
 	if(!(this->soundIo))
 		throw std::runtime_error("Sound::getBackend(): soundIo == nullptr");
 
@@ -168,11 +204,15 @@ std::string Sound::getBackend() const {
 
 // set the current output device by its index (e.g. when received from Sound::listOutputDevices)
 void Sound::setOutputDeviceByIndex(unsigned int index) {
+	this->waitForConnection();
+
 	this->setOutputDevice(index);
 }
 
 // set the current output device by its ID (e.g. when read from a settings file)
 void Sound::setOutputDeviceById(const std::string& id) {
+	this->waitForConnection();
+
 	const auto index = this->outputDeviceIdToIndex(id);
 
 	if(index == -1)
@@ -215,12 +255,69 @@ void Sound::setOutputLatency(double latency) {
 	this->outputLatency = latency;
 }
 
+// add the metrics of the sound system (i.e. durations of the write callback, written frames and underflows) to the registry
+//	NOTE:	The metrics need to be set before the sound system is started, they will be updated without blocking the sound thread.
+void Sound::setMetrics(Metrics * metrics) {
+	if(this->running)
+		throw std::runtime_error("Sound::setMetrics(): the sound system has already been started");
+
+	if(!metrics) {
+		this->metricCallbackTime = nullptr;
+		this->metricFrames = nullptr;
+		this->metricUnderflows = nullptr;
+
+		return;
+	}
+
+	this->metricCallbackTime = &(metrics->addHistogram(
+			"pixels_audio_callback_seconds",
+			"Duration of the audio write callback in seconds."
+	));
+	this->metricFrames = &(metrics->addCounter(
+			"pixels_audio_frames_total",
+			"Number of audio frames written."
+	));
+	this->metricUnderflows = &(metrics->addCounter(
+			"pixels_audio_underflows_total",
+			"Number of audio buffer underflows."
+	));
+}
+
+// set the scheduling configuration of the sound threads (i.e. the thread waiting for events and the one writing the samples)
+//	NOTE:	The configuration needs to be set before the sound system is started.
+//			Memory will be locked by the thread waiting for events, before the output stream is started.
+//			The configuration of the thread writing the samples will be applied by the thread waiting for events
+//			as soon as the first write callback has been called (i.e. not inside the real-time callback itself).
+//			Use Sound::isThreadConfigErrorsOccured to check whether the configuration has been applied successfully.
+void Sound::setThreadConfig(const ThreadConfig& config) {
+	if(this->running)
+		throw std::runtime_error("Sound::setThreadConfig(): the sound system has already been started");
+
+	this->threadConfig = config;
+	this->callbackConfig = config;
+
+	this->callbackConfig.setLockMemory(false);
+}
+
 // start the sound system in an extra thread
+//	NOTE:	The thread will wait for the connection to the backend before opening the output stream,
+//			i.e. this function will not block (use Sound::isStarted to check whether the output stream has been started).
 void Sound::start(double startTimeInSeconds) {
 	if(this->running)
 		// sound system is already running
 		return throw std::runtime_error("The sound system has already been started");
 
+	// join the thread if it has been stopped by an error before
+	if(this->soundThread.joinable())
+		this->soundThread.join();
+
+	this->failed = false;
+	this->threadError = nullptr;
+	this->firstSample = 0;
+	this->threadConfigErrors.clear();
+	this->isCallbackThreadKnown = false;
+	this->isThreadConfigured = false;
+	this->isThreadConfigReported = false;
 	this->started = true;
 	this->secondsOffset = startTimeInSeconds;
 	this->running = true;
@@ -234,7 +331,11 @@ void Sound::stop() {
 		this->started = false;
 		this->running = false;
 
-		soundio_wakeup(this->soundIo);
+		// the thread might still be waiting for the connection
+		this->connection.wait();
+
+		if(this->soundIo)
+			soundio_wakeup(this->soundIo);
 
 		if(this->soundThread.joinable())
 			this->soundThread.join();
@@ -242,10 +343,20 @@ void Sound::stop() {
 }
 
 // check whether sound system has been succesfully started (thread-safe!)
+//	NOTE:	Re-throws any exception that occured while connecting to the backend or starting the output stream.
 bool Sound::isStarted() const {
+	if(this->failed.load(std::memory_order_acquire))
+		std::rethrow_exception(this->threadError);
+
 	return this->initialized;
 }
 
+// check whether the sound system has been successfully started without re-throwing any error (thread-safe!)
+//	NOTE:	Use this function in threads other than the main thread, which should use Sound::isStarted to handle errors.
+bool Sound::isReady() const {
+	return !(this->failed.load(std::memory_order_acquire)) && this->initialized;
+}
+
 // get the actual output sample rate chosen by the device
 // 	NOTE:	The sound system need to be completely started before you can use this function.
 //			You can use Sound::isStarted() to wait until it is ready.
@@ -483,6 +594,29 @@ bool Sound::isOutputWritingErrorsOccured(std::string& lastErrorOut) {
 	return false;
 }
 
+// check whether the scheduling configuration of the sound threads has been applied with errors and get them
+//	NOTE:	Returns false until the configuration has been applied, and reports the errors only once.
+bool Sound::isThreadConfigErrorsOccured(std::string& errorsOut) {
+	if(this->isThreadConfigReported || !(this->isThreadConfigured.load(std::memory_order_acquire)))
+		return false;
+
+	this->isThreadConfigReported = true;
+
+	if(this->threadConfigErrors.empty())
+		return false;
+
+	errorsOut = this->threadConfigErrors;
+
+	return true;
+}
+
+// get the time at which the first samples have been written to the output device (or the epoch of the clock if none yet)
+std::chrono::steady_clock::time_point Sound::getFirstSampleTime() const {
+	return std::chrono::steady_clock::time_point(
+			std::chrono::steady_clock::duration(this->firstSample.load(std::memory_order_acquire))
+	);
+}
+
 // get the current position in time of the sound thread (everything before has already been sent to the output device)
 // NOTE:	Should NOT be called from outside the sound thread (i.e. the callbacks of the sound system) !
 double Sound::getTimePosition() const {
@@ -491,12 +625,27 @@ double Sound::getTimePosition() const {
 
 // thread function for the actual sound output
 void Sound::thread() {
-	// initialize thread-related resources
-	this->threadInit();
+	try {
+		// wait for the connection to the backend
+		this->waitForConnection();
+
+		// initialize thread-related resources
+		this->threadInit();
 
-	// handle sound events while the thread is running
-	while(this->running)
-		soundio_wait_events(this->soundIo);
+		// apply the scheduling configuration to the thread writing the samples
+		this->threadConfigure();
+
+		// handle sound events while the thread is running
+		while(this->running)
+			soundio_wait_events(this->soundIo);
+	}
+	catch(...) {
+		// save the exception to be re-thrown by Sound::isStarted
+		this->threadError = std::current_exception();
+		this->running = false;
+
+		this->failed.store(true, std::memory_order_release);
+	}
 
 	// clear thread-related resources
 	this->threadClear();
@@ -504,6 +653,9 @@ void Sound::thread() {
 
 // initialize thread-related resources
 void Sound::threadInit() {
+	// apply the scheduling configuration (and lock the memory if necessary)
+	this->threadConfigErrors = this->threadConfig.apply();
+
 	// get the output device
 	this->soundIoOutputDevice = soundio_get_output_device(this->soundIo, this->outputDeviceIndex);
 
@@ -584,6 +736,36 @@ void Sound::threadInit() {
 	this->initialized = true;
 }
 
+// wait for the first write callback and apply the scheduling configuration to the thread that called it
+//	NOTE:	The thread writing the samples is created by libsoundio, i.e. it is only known after it has been called.
+void Sound::threadConfigure() {
+	constexpr auto maxWait = std::chrono::seconds(1);
+	constexpr auto step = std::chrono::milliseconds(1);
+
+	if(this->callbackConfig.getRealTime() || !(this->callbackConfig.getAffinity().empty())) {
+		const auto until = std::chrono::steady_clock::now() + maxWait;
+
+		while(
+				this->running
+				&& !(this->isCallbackThreadKnown.load(std::memory_order_acquire))
+				&& std::chrono::steady_clock::now() < until
+		)
+			std::this_thread::sleep_for(step);
+
+		std::string errors;
+
+		if(this->isCallbackThreadKnown.load(std::memory_order_acquire))
+			errors = this->callbackConfig.apply(this->callbackThread);
+		else
+			errors = "no write callback to apply the scheduling configuration to";
+
+		if(!errors.empty())
+			this->threadConfigErrors += (this->threadConfigErrors.empty() ? "" : "; ") + errors;
+	}
+
+	this->isThreadConfigured.store(true, std::memory_order_release);
+}
+
 // clear thread-related resources
 void Sound::threadClear() {
 	this->initialized = false;
@@ -654,6 +836,13 @@ void Sound::onWrite(int frameCountMin, int frameCountMax) {
 
 	const unsigned int channelCount = static_cast<unsigned int>(pointerToLayout->channel_count);
 
+	// remember the thread writing the samples, so that its scheduling configuration can be applied (see Sound::threadConfigure)
+	if(!(this->isCallbackThreadKnown.load(std::memory_order_relaxed))) {
+		this->callbackThread = pthread_self();
+
+		this->isCallbackThreadKnown.store(true, std::memory_order_release);
+	}
+
 	// write a decent number of frames
 	auto framesLeft = frameCountMax;
 
@@ -695,6 +884,16 @@ void Sound::onWrite(int frameCountMin, int frameCountMax) {
 
 		this->secondsOffset += this->secondsPerFrame * frameCount;
 
+		if(this->metricFrames)
+			this->metricFrames->add(frameCount);
+
+		// save the time at which the first samples have been written
+		if(!(this->firstSample.load(std::memory_order_relaxed)))
+			this->firstSample.store(
+					std::chrono::steady_clock::now().time_since_epoch().count(),
+					std::memory_order_release
+			);
+
 		const auto endError = soundio_outstream_end_write(this->soundIoOutStream);
 
 		if(endError) {
@@ -711,6 +910,9 @@ void Sound::onWrite(int frameCountMin, int frameCountMax) {
 // buffer has underflow
 void Sound::onUnderflow() {
 	this->isUnderflow.store(true, std::memory_order_release);
+
+	if(this->metricUnderflows)
+		this->metricUnderflows->add();
 }
 
 // delegate on devices changed event into the class
@@ -749,7 +951,25 @@ void Sound::callbackWrite(SoundIoOutStream * soundIoOutStream, int frameCountMin
 	if(!(soundIoOutStream->device->soundio->userdata))
 		throw std::runtime_error("callbackWrite(): soundIoOutStream->device->soundio->userdata == nullptr");
 
-	static_cast<Sound *>(soundIoOutStream->device->soundio->userdata)->onWrite(frameCountMin, frameCountMax);
+	// the write callback needs to be real-time safe (i.e. it should neither allocate memory, nor lock or block)
+	PIXELS_INSTRUMENT("Sound::onWrite", true);
+
+	auto * sound = static_cast<Sound *>(soundIoOutStream->device->soundio->userdata);
+
+	if(!(sound->metricCallbackTime)) {
+		sound->onWrite(frameCountMin, frameCountMax);
+
+		return;
+	}
+
+	// measure the duration of the callback
+	const auto begin = std::chrono::steady_clock::now();
+
+	sound->onWrite(frameCountMin, frameCountMax);
+
+	sound->metricCallbackTime->observe(
+			std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count()
+	);
 }
 
 // delegate underflow event into class
@@ -817,10 +1037,18 @@ void Sound::setOutputDevice(int index) {
 		restart = true;
 	}
 
+	this->selectOutputDevice(index);
+
+	if(restart)
+		this->start(this->secondsOffset);
+}
+
+// helper function to select the current output device without restarting the thread
+void Sound::selectOutputDevice(int index) {
 	if(index < 0)
 		this->outputDeviceIndex = this->defaultOutputDeviceIndex;
 	else if(index >= soundio_output_device_count(this->soundIo))
-		throw std::runtime_error("Sound::setOutputDevice(): Invalid output device #" + std::to_string(index));
+		throw std::runtime_error("Sound::selectOutputDevice(): Invalid output device #" + std::to_string(index));
 	else
 		this->outputDeviceIndex = index;
 
@@ -837,9 +1065,6 @@ void Sound::setOutputDevice(int index) {
 	soundio_device_unref(tmpDevice);
 
 	tmpDevice = nullptr;
-
-	if(restart)
-		this->start(this->secondsOffset);
 }
 
 // get the pointer to a layout fitting the specified options (i.e. channels) or to the default if none was found
@@ -13,13 +13,20 @@
 #include <soundio/soundio.h>
 
 #include <atomic>		// std::atomic, std::memory_order
+#include <chrono>		// std::chrono
+#include <exception>	// std::current_exception, std::exception_ptr, std::rethrow_exception
 #include <functional>	// std::function
+#include <future>		// std::async, std::launch, std::shared_future
 #include <limits>		// std::numeric_limits
 #include <stdexcept>	// std::runtime_error
 #include <string>		// std::string, std::to_string
-#include <thread>		// std::thread
+#include <thread>		// std::this_thread, std::thread
 #include <vector>		// std::vector
 
+#include "Instrumentation.h"
+#include "Metrics.h"
+#include "ThreadConfig.h"
+
 class Sound {
 public:
 	using OutputFunction = std::function<double(unsigned int, double)>;
@@ -79,12 +86,15 @@ public:
 	void setOutputChannels(unsigned int channels);
 	void setOutputMaxFrames(unsigned int maxFrames);
 	void setOutputLatency(double latency);
+	void setMetrics(Metrics * metrics);
+	void setThreadConfig(const ThreadConfig& config);
 
 	void start(double startTimeInSeconds);
 	void stop();
 
 	// getters for when after the sound system has been started
 	bool isStarted() const;
+	bool isReady() const;
 	int getOutputSampleRate() const;
 	int getOutputChannels() const;
 	double getOutputLatency() const;
@@ -93,13 +103,19 @@ public:
 	std::string getOutputChannelName(unsigned int channel) const;
 	bool isOutputUnderflowOccured();
 	bool isOutputWritingErrorsOccured(std::string& lastErrorOut);
+	bool isThreadConfigErrorsOccured(std::string& errorsOut);
+	std::chrono::steady_clock::time_point getFirstSampleTime() const;
 
 	// getter only for the sound thread
 	double getTimePosition() const;
 
 private:
+	void connect();
+	void waitForConnection() const;
+
 	void thread();
 	void threadInit();
+	void threadConfigure();
 	void threadClear();
 
 	void onDevicesChanged();
@@ -114,6 +130,7 @@ private:
 
 	int outputDeviceIdToIndex(const std::string& id);
 	void setOutputDevice(int index);
+	void selectOutputDevice(int index);
 	const SoundIoChannelLayout& getLayout() const;
 
 	static void writeSampleS16(void * target, double sample);
@@ -125,7 +142,10 @@ private:
 	bool connected;
 	std::atomic<bool> initialized;
 	std::atomic<bool> running;
+	std::atomic<bool> failed;
+	std::shared_future<void> connection;
 	std::thread soundThread;
+	std::exception_ptr threadError;
 	double secondsOffset;
 	double secondsPerFrame;
 
@@ -148,6 +168,19 @@ private:
 
 	std::atomic<bool> isUnderflow;
 	std::atomic<int> lastWritingError;
+	std::atomic<std::chrono::steady_clock::rep> firstSample;
+
+	ThreadConfig threadConfig;
+	ThreadConfig callbackConfig;
+	pthread_t callbackThread;
+	std::atomic<bool> isCallbackThreadKnown;
+	std::string threadConfigErrors;
+	std::atomic<bool> isThreadConfigured;
+	bool isThreadConfigReported;
+
+	Metrics::Histogram * metricCallbackTime;
+	Metrics::Counter * metricFrames;
+	Metrics::Counter * metricUnderflows;
 };
 
 #endif /* SOUND_H_ */
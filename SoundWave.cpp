@@ -15,17 +15,19 @@ SoundWave::SoundWave()
 	  angularVelocity(0.),
 	  noiseGeneratorPointer(nullptr),
 	  samplesPerSecond(0.),
+	  noiseSeed(0),
 	  waveVolume(0.),
 	  analogSawToothN(0) {}
 
 // constructor: set properties of the sound wave, the encompassing envelope and pre-calculate values
 //	NOTE:	The pointer to the pseudo-random number generator is only needed for live noise.
-//			Noise values and the samples per second are only needed for pre-calculated noise.
+//			Noise values are only needed for pre-calculated noise,
+//			the samples per second for pre-calculated and hashed noise (see SoundWave::setNoiseSeed).
 SoundWave::SoundWave(
 		const Properties& properties,
 		const SoundEnvelope& envelope,
 		Rand * noiseGeneratorPointer,
-		const std::vector<double> * noiseValues,
+		const Noise * noiseValues,
 		double samplesPerSecond
 )	: properties(properties),
 	  soundEnvelope(envelope),
@@ -33,6 +35,7 @@ SoundWave::SoundWave(
 	  angularVelocity(0.),
 	  noiseGeneratorPointer(noiseGeneratorPointer),
 	  samplesPerSecond(samplesPerSecond),
+	  noiseSeed(0),
 	  waveVolume(1.),
 	  analogSawToothN(15) {
 	// set type-specific default volumes and precalculate angularVelocity if necessary
@@ -42,7 +45,11 @@ SoundWave::SoundWave(
 	if(this->properties.type == SOUNDWAVE_SQUARE)
 		this->waveVolume = 0.6;
 
-	if(this->properties.type != SOUNDWAVE_SAWTOOTH_OPTIMIZED && this->properties.type != SOUNDWAVE_NOISE)
+	if(
+			this->properties.type != SOUNDWAVE_SAWTOOTH_OPTIMIZED
+			&& this->properties.type != SOUNDWAVE_NOISE
+			&& this->properties.type != SOUNDWAVE_NOISE_HASHED
+	)
 		this->angularVelocity = properties.frequency * 2. * M_PI;
 
 	// change real distribution of noise generator if necessary
@@ -58,7 +65,7 @@ SoundWave::SoundWave(
 			&& samplesPerSecond > 0.
 			&& noiseValues
 	)
-		std::vector<double>(*noiseValues).swap(this->noise);
+		Noise(*noiseValues).swap(this->noise);
 }
 
 // constructor for using a default envelope (sustain only)
@@ -192,6 +199,18 @@ double SoundWave::get(double time) {
 		}
 
 		break;
+
+	case SOUNDWAVE_NOISE_HASHED:
+		// generate pseudo-random output from the number of the sample, i.e. without any state
+		if(this->samplesPerSecond > 0.)
+			return volume * (
+					RandHash::getReal(
+							this->noiseSeed,
+							static_cast<uint64_t>((time - this->properties.startTime) * this->samplesPerSecond)
+					) * 2. - 1.
+			);
+
+		break;
 	}
 
 	return 0.;
@@ -236,6 +255,12 @@ void SoundWave::setAnalogSawToothN(unsigned int n) {
 	this->analogSawToothN = n;
 }
 
+// set the seed for hashed noise (default: 0)
+//	NOTE:	Sound waves with the same seed and the same samples per second will generate the same noise.
+void SoundWave::setNoiseSeed(uint64_t seed) {
+	this->noiseSeed = seed;
+}
+
 // get the type of the wave as a string
 std::string SoundWave::getTypeString() const {
 	switch(this->properties.type) {
@@ -262,6 +287,9 @@ std::string SoundWave::getTypeString() const {
 
 	case SOUNDWAVE_NOISE_PRECALCULATED:
 		return "Pseudo-random noise (precalculated)";
+
+	case SOUNDWAVE_NOISE_HASHED:
+		return "Pseudo-random noise (hashed)";
 	}
 
 	return "<unknown>";
@@ -276,6 +304,7 @@ SoundWave::SoundWave(const SoundWave& other)
   noiseGeneratorPointer(other.noiseGeneratorPointer),
   noise(other.noise),
   samplesPerSecond(other.samplesPerSecond),
+  noiseSeed(other.noiseSeed),
   waveVolume(other.waveVolume),
   analogSawToothN(other.analogSawToothN) {
 }
@@ -289,6 +318,7 @@ SoundWave& SoundWave::operator=(const SoundWave& other) {
 	noiseGeneratorPointer = other.noiseGeneratorPointer;
 	noise = other.noise;
 	samplesPerSecond = other.samplesPerSecond;
+	noiseSeed = other.noiseSeed;
 	waveVolume = other.waveVolume;
 	analogSawToothN = other.analogSawToothN;
 
@@ -308,6 +338,7 @@ SoundWave::SoundWave(SoundWave&& other) {
 	noise.swap(other.noise);
 	
 	swap(samplesPerSecond, other.samplesPerSecond);
+	swap(noiseSeed, other.noiseSeed);
 	swap(waveVolume, other.waveVolume);
 	swap(analogSawToothN, other.analogSawToothN);
 }
@@ -325,6 +356,7 @@ SoundWave& SoundWave::operator=(SoundWave&& other) {
 	noise.swap(other.noise);
 	
 	swap(samplesPerSecond, other.samplesPerSecond);
+	swap(noiseSeed, other.noiseSeed);
 	swap(waveVolume, other.waveVolume);
 	swap(analogSawToothN, other.analogSawToothN);
 
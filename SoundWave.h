@@ -11,17 +11,22 @@
 #pragma once
 
 #include "Math.h"
+#include "Memory.h"
 #include "Rand.h"
+#include "RandHash.h"
 #include "SoundEnvelope.h"
 
 #include <cmath>		// M_2_PI, M_PI, M_PI_2, std::asin, std::fmod
 #include <cstddef>		// std::size_t
+#include <cstdint>		// uint64_t
 #include <string>		// std::string
 #include <vector>		// std::vector
 
 // class representing an abstract sound wave that diminishes over time
 class SoundWave {
 public:
+	using Noise = std::vector<double, Memory::Allocator<double>>;
+
 	enum Type {
 		SOUNDWAVE_NONE,
 		SOUNDWAVE_SINE,
@@ -30,7 +35,8 @@ public:
 		SOUNDWAVE_SAWTOOTH,
 		SOUNDWAVE_SAWTOOTH_OPTIMIZED,
 		SOUNDWAVE_NOISE,
-		SOUNDWAVE_NOISE_PRECALCULATED
+		SOUNDWAVE_NOISE_PRECALCULATED,
+		SOUNDWAVE_NOISE_HASHED
 	};
 
 	struct Properties {
@@ -50,7 +56,7 @@ public:
 			const Properties& properties,
 			const SoundEnvelope& envelope,
 			Rand * noiseGeneratorPointer = nullptr,
-			const std::vector<double> * noiseValues = nullptr,
+			const Noise * noiseValues = nullptr,
 			double samplesPerSecond = 0.
 	);
 	virtual ~SoundWave();
@@ -65,6 +71,7 @@ public:
 	void setEnvelope(const SoundEnvelope& envelope);
 	void setWaveVolume(double volume);
 	void setAnalogSawToothN(unsigned int n);
+	void setNoiseSeed(uint64_t seed);
 
 	void clear();
 
@@ -88,9 +95,12 @@ private:
 	Rand * noiseGeneratorPointer;
 
 	// pre-calculated noise
-	std::vector<double> noise;
+	Noise noise;
 	double samplesPerSecond;
 
+	// seed of hashed noise
+	uint64_t noiseSeed;
+
 	// additional properties (setting them is optional)
 	double waveVolume;
 	double analogSawToothN;
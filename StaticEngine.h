@@ -0,0 +1,378 @@
+/*
+ * StaticEngine.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef STATICENGINE_H_
+#define STATICENGINE_H_
+
+#pragma once
+
+#include <algorithm>			// std::fill_n, std::max, std::min
+#include <cstddef>				// std::size_t
+#include <cstdint>				// uint32_t
+#include <cstring>				// std::memcpy
+#include <sstream>				// std::fixed, std::ostringstream
+#include <string>				// std::string
+#include <type_traits>			// std::false_type, std::integral_constant, std::is_same, std::true_type
+
+#include "MainWindow.h"
+#include "Pixels.h"
+
+// pixel test that lets every pixel pass (i.e. no pixel test at all)
+//	NOTE:	Any other pixel test for StaticEngine needs to provide the same member functions,
+//			which should be inline for the test to be inlined into StaticEngine::draw.
+struct NoPixelTest {
+	void init(unsigned int w, unsigned int h) { UNUSED(w); UNUSED(h); }
+	void frame() {}
+	constexpr bool test(unsigned int x, unsigned int y) const { UNUSED(x); UNUSED(y); return true; }
+};
+
+// engine with the rendering mode, the pixel size, the pixel test and the callbacks resolved at compile time
+//	NOTE:	Derive publicly from StaticEngine<Derived, ...> and define onCreate(), onUpdate(double elapsedTime) and onDestroy()
+//			in the derived class as needed (either public or with the engine as friend), which will be called directly
+//			instead of via virtual functions or std::function.
+//			Use Engine instead to change the rendering mode or the pixel size at runtime, or to use layers,
+//			post-processing, recording and other features of the main window that are not available here.
+template<
+		typename Derived,
+		MainWindow::RenderingMode Mode = MainWindow::RENDERING_MODE_TEXTURE,
+		unsigned short PixelSize = 1,
+		typename Test = NoPixelTest
+>
+class StaticEngine {
+	static_assert(PixelSize > 0, "StaticEngine: the pixel size needs to be positive");
+
+public:
+	StaticEngine();
+	virtual ~StaticEngine();
+
+	void setClearBuffer(bool clear);
+	void setHugePages(Memory::HugePages hugePages);
+	void setDebugText(const std::string& string);
+
+	void createMainWindow(int width, int height, const std::string& title);
+
+	void run();
+
+	// functions to hide in the derived class
+	void onCreate() {}
+	void onUpdate(double elapsedTime) { UNUSED(elapsedTime); }
+	void onDestroy() {}
+
+protected:
+	int getWindowWidth() const;
+	int getWindowHeight() const;
+	double getTime() const;
+	Test& getPixelTest();
+
+	void draw(int x, int y, unsigned char r, unsigned char g, unsigned char b);
+	void fill(int x1, int y1, int x2, int y2, unsigned char r, unsigned char g, unsigned char b);
+
+	template<typename Kernel> void shade(Kernel kernel);
+
+	bool isKeyPressed(unsigned int code) const;
+	bool isKeyHeld(unsigned int code) const;
+	bool isKeyReleased(unsigned int code) const;
+	bool isKeyRepeated(unsigned int code) const;
+
+private:
+	static constexpr bool direct = Mode != MainWindow::RENDERING_MODE_POINTS;
+	static constexpr bool testing = !std::is_same<Test, NoPixelTest>::value;
+
+	// tags for choosing the implementation at compile time
+	using Direct = std::integral_constant<bool, direct>;
+	using Unchecked = std::integral_constant<bool, direct && !testing && PixelSize == 1>;
+
+	void beginFrame();
+	void getBuffer(std::true_type);
+	void getBuffer(std::false_type);
+	void put(int x, int y, uint32_t color);
+	void write(int x, int y, uint32_t color, std::true_type);
+	void write(int x, int y, uint32_t color, std::false_type);
+
+	template<typename Kernel> void shade(Kernel& kernel, std::true_type);
+	template<typename Kernel> void shade(Kernel& kernel, std::false_type);
+
+	MainWindow window;
+	Test pixelTest;
+
+	uint32_t * buffer;
+	int stride;
+	int physicalHeight;
+	int width;
+	int height;
+
+	double oldTime;
+	std::string debug;
+	bool debugChanged;
+};
+
+// constructor and destructor
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+StaticEngine<Derived, Mode, PixelSize, Test>::StaticEngine()
+		: buffer(nullptr),
+		  stride(0),
+		  physicalHeight(0),
+		  width(0),
+		  height(0),
+		  oldTime(0.),
+		  debugChanged(false) {}
+
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+StaticEngine<Derived, Mode, PixelSize, Test>::~StaticEngine() {}
+
+// set whether to clear the buffer every frame
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+void StaticEngine<Derived, Mode, PixelSize, Test>::setClearBuffer(bool clear) {
+	this->window.setClearBuffer(clear);
+}
+
+// set whether and how to use huge pages for the pixel buffer
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+void StaticEngine<Derived, Mode, PixelSize, Test>::setHugePages(Memory::HugePages hugePages) {
+	this->window.setHugePages(hugePages);
+}
+
+// set additional debugging information to be shown in the window title
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+void StaticEngine<Derived, Mode, PixelSize, Test>::setDebugText(const std::string& string) {
+	if(string != this->debug) {
+		this->debug = string;
+		this->debugChanged = true;
+	}
+}
+
+// create the main window with the rendering mode and the pixel size of the engine
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+void StaticEngine<Derived, Mode, PixelSize, Test>::createMainWindow(int width, int height, const std::string& title) {
+	this->window.setRenderingMode(Mode);
+	this->window.setPixelSize(PixelSize);
+	this->window.init(width, height, title);
+}
+
+// run the engine
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+void StaticEngine<Derived, Mode, PixelSize, Test>::run() {
+	auto& derived = static_cast<Derived&>(*this);
+
+	// initialize application-specific data
+	derived.onCreate();
+
+	while(this->window.beginFrame()) {
+		// update frame
+		this->beginFrame();
+
+		derived.onUpdate(this->window.getElapsedTime());
+
+		this->window.endFrame();
+
+		// show framerate in title bar
+		const double newTime = this->window.getTime();
+
+		if(this->debugChanged || newTime - this->oldTime > 0.25) {
+			std::ostringstream oss;
+
+			oss.precision(2);
+
+			oss << std::fixed << this->window.getFPS() << "fps";
+
+			if(!(this->debug.empty()))
+				oss << ", " << this->debug;
+
+			this->window.setDebugText(oss.str());
+
+			this->oldTime = newTime;
+			this->debugChanged = false;
+		}
+	}
+
+	derived.onDestroy();
+}
+
+// get the window width (in pixels of the engine's pixel size)
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+int StaticEngine<Derived, Mode, PixelSize, Test>::getWindowWidth() const {
+	return this->window.getWidth();
+}
+
+// get the window height (in pixels of the engine's pixel size)
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+int StaticEngine<Derived, Mode, PixelSize, Test>::getWindowHeight() const {
+	return this->window.getHeight();
+}
+
+// get the current (run)time
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+double StaticEngine<Derived, Mode, PixelSize, Test>::getTime() const {
+	return this->window.getTime();
+}
+
+// get the pixel test
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+Test& StaticEngine<Derived, Mode, PixelSize, Test>::getPixelTest() {
+	return this->pixelTest;
+}
+
+// draw a pixel at the specified window position (x, y) with the specified color (r, g, b)
+//	NOTE:	The position will not be checked, i.e. it needs to be inside the window.
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+inline void StaticEngine<Derived, Mode, PixelSize, Test>::draw(
+		int x,
+		int y,
+		unsigned char r,
+		unsigned char g,
+		unsigned char b
+) {
+	this->put(x, y, Pixels::pack(r, g, b));
+}
+
+// fill pixels between the specified window positions (x1, y1 and x2, y2) with the specified color (r, g, b)
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+void StaticEngine<Derived, Mode, PixelSize, Test>::fill(
+		int x1,
+		int y1,
+		int x2,
+		int y2,
+		unsigned char r,
+		unsigned char g,
+		unsigned char b
+) {
+	x1 = std::max(x1, 0);
+	y1 = std::max(y1, 0);
+	x2 = std::min(x2, this->width);
+	y2 = std::min(y2, this->height);
+
+	const uint32_t color = Pixels::pack(r, g, b);
+
+	for(int y = y1; y < y2; ++y)
+		for(int x = x1; x < x2; ++x)
+			this->put(x, y, color);
+}
+
+// evaluate the specified kernel for every pixel in the window, row by row
+//	NOTE:	The kernel will be called as kernel(int x, int y) and needs to return a packed color (see Pixels::pack).
+//			Without a pixel test and with a pixel size of one, the colors will be written directly into the pixel buffer.
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+template<typename Kernel> void StaticEngine<Derived, Mode, PixelSize, Test>::shade(Kernel kernel) {
+	this->shade(kernel, Unchecked());
+}
+
+// check whether a key has been pressed THIS frame
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+bool StaticEngine<Derived, Mode, PixelSize, Test>::isKeyPressed(unsigned int code) const {
+	return this->window.isKeyPressed(code);
+}
+
+// check whether a key is held (works continiously over multiple frames)
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+bool StaticEngine<Derived, Mode, PixelSize, Test>::isKeyHeld(unsigned int code) const {
+	return this->window.isKeyHeld(code);
+}
+
+// check whether a key has been released THIS frame
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+bool StaticEngine<Derived, Mode, PixelSize, Test>::isKeyReleased(unsigned int code) const {
+	return this->window.isKeyReleased(code);
+}
+
+// check whether a key is being repeated
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+bool StaticEngine<Derived, Mode, PixelSize, Test>::isKeyRepeated(unsigned int code) const {
+	return this->window.isKeyRepeated(code);
+}
+
+// get the pixel buffer and the size of the window for the current frame, and notify the pixel test
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+void StaticEngine<Derived, Mode, PixelSize, Test>::beginFrame() {
+	const int w = this->window.getWidth();
+	const int h = this->window.getHeight();
+
+	if(w != this->width || h != this->height) {
+		this->width = w;
+		this->height = h;
+
+		this->pixelTest.init(w, h);
+	}
+
+	this->pixelTest.frame();
+
+	this->getBuffer(Direct());
+}
+
+// get the pixel buffer of the current frame
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+void StaticEngine<Derived, Mode, PixelSize, Test>::getBuffer(std::true_type) {
+	auto& pixels = this->window.getBuffer();
+
+	this->buffer = static_cast<uint32_t *>(pixels.get());
+	this->stride = pixels.getWidth();
+	this->physicalHeight = pixels.getHeight();
+}
+
+// no pixel buffer is used when drawing OpenGL points
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+void StaticEngine<Derived, Mode, PixelSize, Test>::getBuffer(std::false_type) {}
+
+// test and write one packed color (see Pixels::pack) at the specified position (x, y)
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+inline void StaticEngine<Derived, Mode, PixelSize, Test>::put(int x, int y, uint32_t color) {
+	// (the condition is constant, i.e. it will be removed without a pixel test)
+	if(testing && !(this->pixelTest.test(x, y)))
+		return;
+
+	this->write(x, y, color, Direct());
+}
+
+// write one packed color at the specified position (x, y) into the pixel buffer
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+inline void StaticEngine<Derived, Mode, PixelSize, Test>::write(int x, int y, uint32_t color, std::true_type) {
+	if(PixelSize == 1) {
+		this->buffer[static_cast<std::size_t>(y) * this->stride + x] = color;
+
+		return;
+	}
+
+	// fill the physical pixels, clipped to the buffer
+	const int offsetX = x * PixelSize;
+	const int offsetY = y * PixelSize;
+	const int limitX = std::min(static_cast<int>(PixelSize), this->stride - offsetX);
+	const int limitY = std::min(static_cast<int>(PixelSize), this->physicalHeight - offsetY);
+
+	for(int relY = 0; relY < limitY; ++relY)
+		std::fill_n(this->buffer + static_cast<std::size_t>(offsetY + relY) * this->stride + offsetX, limitX, color);
+}
+
+// draw one packed color at the specified position (x, y) as an OpenGL point
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+inline void StaticEngine<Derived, Mode, PixelSize, Test>::write(int x, int y, uint32_t color, std::false_type) {
+	unsigned char rgba[4];
+
+	std::memcpy(rgba, &color, sizeof rgba);
+
+	glColor4ubv(rgba);
+	glVertex2i(x * PixelSize + PixelSize / 2, y * PixelSize + PixelSize / 2);
+}
+
+// evaluate the kernel for every pixel, writing the colors directly into the pixel buffer
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+template<typename Kernel> void StaticEngine<Derived, Mode, PixelSize, Test>::shade(Kernel& kernel, std::true_type) {
+	for(int y = 0; y < this->height; ++y) {
+		uint32_t * out = this->buffer + static_cast<std::size_t>(y) * this->stride;
+
+		for(int x = 0; x < this->width; ++x)
+			out[x] = kernel(x, y);
+	}
+}
+
+// evaluate the kernel for every pixel, testing and writing every color separately
+template<typename Derived, MainWindow::RenderingMode Mode, unsigned short PixelSize, typename Test>
+template<typename Kernel> void StaticEngine<Derived, Mode, PixelSize, Test>::shade(Kernel& kernel, std::false_type) {
+	for(int y = 0; y < this->height; ++y)
+		for(int x = 0; x < this->width; ++x)
+			this->put(x, y, kernel(x, y));
+}
+
+#endif /* STATICENGINE_H_ */
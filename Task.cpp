@@ -0,0 +1,239 @@
+/*
+ * Task.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#include "Task.h"
+
+#ifdef PIXELS_COROUTINES
+
+// create the task from the coroutine
+Task Task::promise_type::get_return_object() {
+	return Task(Handle::from_promise(*this));
+}
+
+// store an exception thrown inside the task to be rethrown by the scheduler
+void Task::promise_type::unhandled_exception() {
+	this->exception = std::current_exception();
+}
+
+// constructor creating an empty task
+Task::Task() {}
+
+// constructor taking ownership of the coroutine
+Task::Task(Handle handle) : handle(handle) {}
+
+// move constructor
+Task::Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+
+// move assignment operator
+Task& Task::operator=(Task&& other) noexcept {
+	if(this != &other) {
+		if(this->handle)
+			this->handle.destroy();
+
+		this->handle = std::exchange(other.handle, nullptr);
+	}
+
+	return *this;
+}
+
+// destructor destroying the coroutine
+Task::~Task() {
+	if(this->handle)
+		this->handle.destroy();
+}
+
+// check whether the task has finished (or is empty)
+bool Task::isDone() const {
+	return !(this->handle) || this->handle.done();
+}
+
+// constructor of the awaitable resuming the task in the next frame
+TaskScheduler::NextFrame::NextFrame(TaskScheduler& scheduler) : scheduler(scheduler) {}
+
+// suspend the task until the next frame
+void TaskScheduler::NextFrame::await_suspend(std::coroutine_handle<> handle) {
+	this->scheduler.waiting.push_back(handle);
+}
+
+// constructor of the awaitable resuming the task after the specified time
+TaskScheduler::Delay::Delay(TaskScheduler& scheduler, double seconds) : scheduler(scheduler), seconds(seconds) {}
+
+// suspend the task until the time has passed
+void TaskScheduler::Delay::await_suspend(std::coroutine_handle<> handle) {
+	this->scheduler.timers.emplace_back(Timer{this->scheduler.time + this->seconds, handle});
+}
+
+// constructor of the awaitable running the specified function in the background
+TaskScheduler::Background::Background(TaskScheduler& scheduler, std::function<void()> function)
+		: scheduler(scheduler), function(std::move(function)) {}
+
+// suspend the task and queue the function to be run by a background thread, starting the threads if necessary
+void TaskScheduler::Background::await_suspend(std::coroutine_handle<> handle) {
+	std::lock_guard<std::mutex> guard(this->scheduler.lock);
+
+	if(this->scheduler.threads.empty()) {
+		const unsigned int cpus = std::thread::hardware_concurrency();
+
+		this->scheduler.running = true;
+
+		for(unsigned int n = 0; n < std::max(cpus, 2u) - 1; ++n)
+			this->scheduler.threads.emplace_back(&TaskScheduler::thread, &(this->scheduler));
+	}
+
+	this->scheduler.jobs.emplace_back(Job{this, handle});
+
+	this->scheduler.wakeUp.notify_one();
+}
+
+// rethrow an exception thrown by the function inside the task (if any)
+void TaskScheduler::Background::await_resume() {
+	if(this->exception)
+		std::rethrow_exception(this->exception);
+}
+
+// constructor
+TaskScheduler::TaskScheduler() : time(0.), running(false) {}
+
+// destructor stopping all tasks
+TaskScheduler::~TaskScheduler() {
+	this->stop();
+}
+
+// start the specified task in the next frame
+void TaskScheduler::start(Task task) {
+	if(!task.handle)
+		return;
+
+	this->waiting.push_back(task.handle);
+	this->tasks.emplace_back(std::move(task));
+}
+
+// resume all tasks that are waiting for the current frame, have waited long enough or whose background work has finished,
+//	and remove the tasks that have finished
+//	NOTE:	An exception thrown inside a task will be rethrown here after the task has been removed.
+void TaskScheduler::resume(double time) {
+	this->time = time;
+
+	std::vector<std::coroutine_handle<>> ready;
+
+	ready.swap(this->waiting);
+
+	for(auto it = this->timers.begin(); it != this->timers.end();) {
+		if(it->time <= time) {
+			ready.push_back(it->handle);
+
+			it = this->timers.erase(it);
+		}
+		else
+			++it;
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+
+		ready.insert(ready.end(), this->finished.begin(), this->finished.end());
+
+		this->finished.clear();
+	}
+
+	for(const auto handle : ready)
+		handle.resume();
+
+	// remove finished tasks
+	std::exception_ptr exception;
+
+	for(auto it = this->tasks.begin(); it != this->tasks.end();) {
+		if(it->isDone()) {
+			if(!exception)
+				exception = it->handle.promise().exception;
+
+			it = this->tasks.erase(it);
+		}
+		else
+			++it;
+	}
+
+	if(exception)
+		std::rethrow_exception(exception);
+}
+
+// stop all tasks, waiting for the background work that is currently running to finish
+void TaskScheduler::stop() {
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+
+		this->running = false;
+
+		this->jobs.clear();
+	}
+
+	this->wakeUp.notify_all();
+
+	for(auto& thread : this->threads)
+		if(thread.joinable())
+			thread.join();
+
+	this->threads.clear();
+
+	this->waiting.clear();
+	this->timers.clear();
+	this->finished.clear();
+	this->tasks.clear();
+}
+
+// get an awaitable resuming the task in the next frame
+TaskScheduler::NextFrame TaskScheduler::nextFrame() {
+	return NextFrame(*this);
+}
+
+// get an awaitable resuming the task after the specified time (in seconds)
+TaskScheduler::Delay TaskScheduler::seconds(double seconds) {
+	return Delay(*this, seconds);
+}
+
+// get an awaitable running the specified function in a background thread
+TaskScheduler::Background TaskScheduler::runInBackground(std::function<void()> function) {
+	return Background(*this, std::move(function));
+}
+
+// get the number of tasks that have not finished yet
+std::size_t TaskScheduler::getTasks() const {
+	return this->tasks.size();
+}
+
+// background thread
+void TaskScheduler::thread() {
+	std::unique_lock<std::mutex> uniqueLock(this->lock);
+
+	while(true) {
+		this->wakeUp.wait(uniqueLock, [this]() {
+			return !(this->running) || !(this->jobs.empty());
+		});
+
+		if(!(this->running))
+			break;
+
+		const Job job = this->jobs.front();
+
+		this->jobs.pop_front();
+
+		uniqueLock.unlock();
+
+		try {
+			job.background->function();
+		}
+		catch(...) {
+			job.background->exception = std::current_exception();
+		}
+
+		uniqueLock.lock();
+
+		this->finished.push_back(job.handle);
+	}
+}
+
+#endif /* PIXELS_COROUTINES */
@@ -0,0 +1,164 @@
+/*
+ * Task.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef TASK_H_
+#define TASK_H_
+
+#pragma once
+
+// coroutines running on the main thread over multiple frames (e.g. for animations or for loading resources in the background)
+//	NOTE:	Tasks are only available when compiling with C++20 coroutines (e.g. -std=c++20),
+//			in which case PIXELS_COROUTINES will be defined.
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#define PIXELS_COROUTINES
+
+#include <algorithm>			// std::max
+#include <condition_variable>	// std::condition_variable
+#include <coroutine>			// std::coroutine_handle, std::suspend_always
+#include <cstddef>				// std::size_t
+#include <deque>				// std::deque
+#include <exception>			// std::current_exception, std::exception_ptr, std::rethrow_exception
+#include <functional>			// std::function
+#include <mutex>				// std::lock_guard, std::mutex, std::unique_lock
+#include <thread>				// std::thread
+#include <utility>				// std::exchange, std::move
+#include <vector>				// std::vector
+
+// a coroutine to be run by a task scheduler (i.e. a function returning Task that uses co_await)
+//	NOTE:	A task will not run before it has been started by a scheduler (see Engine::startTask).
+//			Tasks cannot await each other.
+class Task {
+public:
+	struct promise_type {
+		Task get_return_object();
+
+		std::suspend_always initial_suspend() noexcept { return {}; }
+		std::suspend_always final_suspend() noexcept { return {}; }
+
+		void return_void() {}
+		void unhandled_exception();
+
+		std::exception_ptr exception;
+	};
+
+	using Handle = std::coroutine_handle<promise_type>;
+
+	Task();
+	explicit Task(Handle handle);
+	Task(Task&& other) noexcept;
+	Task& operator=(Task&& other) noexcept;
+	virtual ~Task();
+
+	bool isDone() const;
+
+	Task(const Task&) = delete;
+	Task& operator=(const Task&) = delete;
+
+private:
+	friend class TaskScheduler;
+
+	Handle handle;
+};
+
+// scheduler resuming tasks on the main thread once per frame
+//	NOTE:	Only the work given to runInBackground will be run by the background threads,
+//			everything else (including the task after the work has been done) will be run by the thread calling resume.
+class TaskScheduler {
+public:
+	// awaitable resuming the task in the next frame
+	class NextFrame {
+	public:
+		explicit NextFrame(TaskScheduler& scheduler);
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<> handle);
+		void await_resume() const noexcept {}
+
+	private:
+		TaskScheduler& scheduler;
+	};
+
+	// awaitable resuming the task in the first frame after the specified time (in seconds) has passed
+	class Delay {
+	public:
+		Delay(TaskScheduler& scheduler, double seconds);
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<> handle);
+		void await_resume() const noexcept {}
+
+	private:
+		TaskScheduler& scheduler;
+		double seconds;
+	};
+
+	// awaitable running the specified function in a background thread and resuming the task in the first frame after it finished
+	//	NOTE:	Exceptions thrown by the function will be rethrown inside the task.
+	class Background {
+	public:
+		Background(TaskScheduler& scheduler, std::function<void()> function);
+
+		bool await_ready() const noexcept { return false; }
+		void await_suspend(std::coroutine_handle<> handle);
+		void await_resume();
+
+	private:
+		friend class TaskScheduler;
+
+		TaskScheduler& scheduler;
+		std::function<void()> function;
+		std::exception_ptr exception;
+	};
+
+	TaskScheduler();
+	virtual ~TaskScheduler();
+
+	void start(Task task);
+	void resume(double time);
+	void stop();
+
+	NextFrame nextFrame();
+	Delay seconds(double seconds);
+	Background runInBackground(std::function<void()> function);
+
+	std::size_t getTasks() const;
+
+	TaskScheduler(const TaskScheduler&) = delete;
+	TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+private:
+	struct Job {
+		Background * background;
+		std::coroutine_handle<> handle;
+	};
+
+	struct Timer {
+		double time;
+		std::coroutine_handle<> handle;
+	};
+
+	void thread();
+
+	// main thread
+	std::vector<Task> tasks;
+	std::vector<std::coroutine_handle<>> waiting;
+	std::vector<Timer> timers;
+	double time;
+
+	// background threads
+	std::vector<std::thread> threads;
+	std::mutex lock;
+	std::condition_variable wakeUp;
+	std::deque<Job> jobs;
+	std::vector<std::coroutine_handle<>> finished;
+	bool running;
+};
+
+#endif /* defined(__cpp_impl_coroutine) && __has_include(<coroutine>) */
+
+#endif /* TASK_H_ */
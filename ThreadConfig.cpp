@@ -0,0 +1,194 @@
+/*
+ * ThreadConfig.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#include "ThreadConfig.h"
+
+// constructor using the default scheduling on any CPU without locking memory
+ThreadConfig::ThreadConfig() : realTime(0), lockMemory(false) {}
+
+// destructor
+ThreadConfig::~ThreadConfig() {}
+
+// set the real-time priority of the thread (1 to 99, using SCHED_FIFO; default: 0, i.e. the default scheduling)
+void ThreadConfig::setRealTime(int priority) {
+	if(priority < 0 || priority > 99)
+		throw std::runtime_error("ThreadConfig::setRealTime(): invalid priority " + std::to_string(priority));
+
+	this->realTime = priority;
+}
+
+// set the CPUs the thread may run on (default: empty, i.e. any CPU)
+void ThreadConfig::setAffinity(const std::vector<unsigned int>& cpus) {
+	this->affinity = cpus;
+}
+
+// set whether all current and future memory of the process should be locked into RAM (default: false)
+//	NOTE:	This avoids page faults (e.g. in the sound thread), but affects the whole process,
+//			i.e. any later mapping (e.g. of huge pages or pixel buffer objects) will fail when exceeding RLIMIT_MEMLOCK.
+void ThreadConfig::setLockMemory(bool lock) {
+	this->lockMemory = lock;
+}
+
+// get the real-time priority of the thread (0 if the default scheduling is used)
+int ThreadConfig::getRealTime() const {
+	return this->realTime;
+}
+
+// get the CPUs the thread may run on (empty if any)
+const std::vector<unsigned int>& ThreadConfig::getAffinity() const {
+	return this->affinity;
+}
+
+// get whether the memory of the process should be locked into RAM
+bool ThreadConfig::isLockMemory() const {
+	return this->lockMemory;
+}
+
+// get a copy of the configuration pinned to a single CPU, chosen from the CPUs of the configuration by the specified index
+//	(e.g. the index of a worker thread), or from all CPUs if the configuration does not restrict them
+ThreadConfig ThreadConfig::pinned(unsigned int index) const {
+	ThreadConfig result(*this);
+
+	if(this->affinity.empty()) {
+		const auto cpus(ThreadConfig::getAllowedCPUs());
+
+		result.affinity = { cpus[index % cpus.size()] };
+	}
+	else
+		result.affinity = { this->affinity[index % this->affinity.size()] };
+
+	return result;
+}
+
+// apply the configuration to the calling thread and return a description of all failures (or an empty string on success)
+std::string ThreadConfig::apply() const {
+	return this->apply(pthread_self());
+}
+
+// apply the configuration to the specified thread (e.g. one created by a library) and return a description of all failures
+//	NOTE:	Memory will be locked for the whole process, not only for the specified thread.
+std::string ThreadConfig::apply(pthread_t thread) const {
+	std::string errors;
+
+	// lock memory
+	if(this->lockMemory && mlockall(MCL_CURRENT | MCL_FUTURE))
+		ThreadConfig::addError(errors, "mlockall", errno);
+
+	// set CPU affinity
+	if(!(this->affinity.empty())) {
+		cpu_set_t cpus;
+
+		CPU_ZERO(&cpus);
+
+		for(const auto cpu : this->affinity) {
+			if(cpu >= CPU_SETSIZE) {
+				ThreadConfig::addError(errors, "CPU_SET (CPU #" + std::to_string(cpu) + ")", EINVAL);
+
+				continue;
+			}
+
+			CPU_SET(cpu, &cpus);
+		}
+
+		const int error = pthread_setaffinity_np(thread, sizeof cpus, &cpus);
+
+		if(error)
+			ThreadConfig::addError(errors, "pthread_setaffinity_np", error);
+	}
+
+	// set real-time priority
+	if(this->realTime) {
+		sched_param parameter{};
+
+		parameter.sched_priority = this->realTime;
+
+		int error = pthread_setschedparam(thread, SCHED_FIFO, &parameter);
+
+		if(error == EPERM) {
+			// try to raise the soft limit for real-time priorities up to the hard limit
+			rlimit limit{};
+
+			if(
+					!getrlimit(RLIMIT_RTPRIO, &limit)
+					&& limit.rlim_cur < static_cast<rlim_t>(this->realTime)
+					&& limit.rlim_max >= static_cast<rlim_t>(this->realTime)
+			) {
+				limit.rlim_cur = this->realTime;
+
+				if(!setrlimit(RLIMIT_RTPRIO, &limit))
+					error = pthread_setschedparam(thread, SCHED_FIFO, &parameter);
+			}
+		}
+
+		if(error)
+			ThreadConfig::addError(
+					errors,
+					"pthread_setschedparam (SCHED_FIFO, priority "
+					+ std::to_string(this->realTime)
+					+ ", check RLIMIT_RTPRIO)",
+					error
+			);
+	}
+
+	return errors;
+}
+
+// get the number of CPUs the process may run on (at least one)
+unsigned int ThreadConfig::getCPUs() {
+	return static_cast<unsigned int>(ThreadConfig::getAllowedCPUs().size());
+}
+
+// get the CPUs the process may run on (e.g. restricted by a cpuset or taskset, never empty)
+//	NOTE:	Uses the affinity of the calling thread, i.e. it should be called before any affinity has been set.
+std::vector<unsigned int> ThreadConfig::getAllowedCPUs() {
+	std::vector<unsigned int> result;
+	cpu_set_t cpus;
+
+	CPU_ZERO(&cpus);
+
+	if(!sched_getaffinity(0, sizeof cpus, &cpus)) {
+		for(unsigned int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+			if(CPU_ISSET(cpu, &cpus))
+				result.push_back(cpu);
+	}
+
+	if(result.empty()) {
+		// fall back to the number of hardware threads
+		const unsigned int count = std::thread::hardware_concurrency();
+
+		for(unsigned int cpu = 0; cpu < (count ? count : 1); ++cpu)
+			result.push_back(cpu);
+	}
+
+	return result;
+}
+
+// get the last CPU the process may run on (e.g. to be reserved for sound)
+unsigned int ThreadConfig::getLastCPU() {
+	return ThreadConfig::getAllowedCPUs().back();
+}
+
+// get all CPUs the process may run on except the specified one (e.g. to keep other threads off the CPU used for sound)
+//	NOTE:	Returns all of them if there is only one.
+std::vector<unsigned int> ThreadConfig::getCPUsExcept(unsigned int cpu) {
+	const auto cpus(ThreadConfig::getAllowedCPUs());
+	std::vector<unsigned int> result;
+
+	for(const auto n : cpus)
+		if(n != cpu || cpus.size() == 1)
+			result.push_back(n);
+
+	return result;
+}
+
+// add the description of a failure to the errors
+void ThreadConfig::addError(std::string& errors, const std::string& what, int error) {
+	if(!errors.empty())
+		errors += "; ";
+
+	errors += what + " failed: " + std::system_category().message(error);
+}
@@ -0,0 +1,59 @@
+/*
+ * ThreadConfig.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: ans
+ */
+
+#ifndef THREADCONFIG_H_
+#define THREADCONFIG_H_
+
+#pragma once
+
+#include <pthread.h>	// pthread_self, pthread_setaffinity_np, pthread_setschedparam, pthread_t
+#include <sched.h>		// cpu_set_t, sched_getaffinity, sched_param, CPU_ISSET, CPU_SET, CPU_SETSIZE, CPU_ZERO, SCHED_FIFO
+#include <sys/mman.h>	// mlockall, MCL_CURRENT, MCL_FUTURE
+#include <sys/resource.h>	// getrlimit, setrlimit, rlimit, RLIMIT_RTPRIO
+
+#include <cerrno>		// errno, EINVAL, EPERM
+#include <stdexcept>	// std::runtime_error
+#include <string>		// std::string, std::to_string
+#include <system_error>	// std::system_category
+#include <thread>		// std::thread
+#include <vector>		// std::vector
+
+// configuration of the scheduling of a thread (i.e. its real-time priority and the CPUs it may run on)
+//	and of the memory of the process (i.e. whether it should be locked into RAM)
+//	NOTE:	The configuration needs to be applied from inside the thread (or to its handle), failures will be returned instead of thrown,
+//			because the necessary permissions (e.g. RLIMIT_RTPRIO, CAP_SYS_NICE) are often missing.
+class ThreadConfig {
+public:
+	ThreadConfig();
+	virtual ~ThreadConfig();
+
+	void setRealTime(int priority);
+	void setAffinity(const std::vector<unsigned int>& cpus);
+	void setLockMemory(bool lock);
+
+	int getRealTime() const;
+	const std::vector<unsigned int>& getAffinity() const;
+	bool isLockMemory() const;
+
+	ThreadConfig pinned(unsigned int index) const;
+	std::string apply() const;
+	std::string apply(pthread_t thread) const;
+
+	static unsigned int getCPUs();
+	static std::vector<unsigned int> getAllowedCPUs();
+	static unsigned int getLastCPU();
+	static std::vector<unsigned int> getCPUsExcept(unsigned int cpu);
+
+private:
+	static void addError(std::string& errors, const std::string& what, int error);
+
+	int realTime;
+	std::vector<unsigned int> affinity;
+	bool lockMemory;
+};
+
+#endif /* THREADCONFIG_H_ */
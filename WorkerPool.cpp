@@ -0,0 +1,192 @@
+/*
+ * WorkerPool.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#include "WorkerPool.h"
+
+// constructor stub (use WorkerPool::start to create the worker threads)
+WorkerPool::WorkerPool()
+		: currentJob(nullptr),
+		  currentSize(0),
+		  generation(0),
+		  pending(0),
+		  running(false),
+		  isThreadConfigSet(false) {}
+
+// destructor stopping the worker threads
+WorkerPool::~WorkerPool() {
+	this->stop();
+}
+
+// start the specified number of worker threads (zero means processing everything in the calling thread)
+void WorkerPool::start(unsigned int workers) {
+	this->stop();
+
+	unsigned long currentGeneration = 0;
+
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+
+		this->running = true;
+
+		// new workers wait for the next job, not for the ones already processed before
+		currentGeneration = this->generation;
+	}
+
+	this->threads.reserve(workers);
+
+	for(unsigned int n = 0; n < workers; ++n)
+		this->threads.emplace_back(&WorkerPool::thread, this, n + 1, currentGeneration);
+}
+
+// stop and join all worker threads
+void WorkerPool::stop() {
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+
+		this->running = false;
+	}
+
+	this->wakeUp.notify_all();
+
+	for(auto& worker : this->threads)
+		if(worker.joinable())
+			worker.join();
+
+	this->threads.clear();
+}
+
+// set the scheduling configuration of the worker threads, each of which will be pinned to one of its CPUs (see ThreadConfig::pinned)
+//	NOTE:	The configuration will be applied to worker threads started afterwards.
+void WorkerPool::setThreadConfig(const ThreadConfig& config) {
+	this->threadConfig = config;
+	this->isThreadConfigSet = true;
+}
+
+// check whether the scheduling configuration of the worker threads has been applied with errors and get them
+//	NOTE:	Resets the errors when called.
+bool WorkerPool::isThreadConfigErrorsOccured(std::string& errorsOut) {
+	std::lock_guard<std::mutex> guard(this->lock);
+
+	if(this->threadConfigErrors.empty())
+		return false;
+
+	errorsOut.swap(this->threadConfigErrors);
+
+	this->threadConfigErrors.clear();
+
+	return true;
+}
+
+// get the number of bands the work will be split into (i.e. the number of workers plus the calling thread)
+unsigned int WorkerPool::getBands() const {
+	return static_cast<unsigned int>(this->threads.size()) + 1;
+}
+
+// split n elements into bands, process them in parallel and wait for all of them to finish
+//	NOTE:	The first exception thrown by the job (if any) will be re-thrown afterwards.
+void WorkerPool::run(std::size_t n, const Job& job) {
+	if(!n || !job)
+		return;
+
+	if(this->threads.empty()) {
+		job(0, n, 0);
+
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> guard(this->lock);
+
+		this->currentJob = &job;
+		this->currentSize = n;
+		this->pending = static_cast<unsigned int>(this->threads.size());
+		this->lastException = nullptr;
+
+		++(this->generation);
+	}
+
+	this->wakeUp.notify_all();
+
+	// process the first band in the calling thread
+	this->process(0);
+
+	// wait for the workers
+	std::unique_lock<std::mutex> guard(this->lock);
+
+	this->finished.wait(guard, [this] { return !(this->pending); });
+
+	this->currentJob = nullptr;
+
+	if(this->lastException)
+		std::rethrow_exception(this->lastException);
+}
+
+// thread function of a worker, waiting for jobs after the specified generation
+void WorkerPool::thread(unsigned int band, unsigned long lastGeneration) {
+	// apply the scheduling configuration if necessary
+	if(this->isThreadConfigSet) {
+		const std::string errors(this->threadConfig.pinned(band - 1).apply());
+
+		if(!errors.empty()) {
+			std::lock_guard<std::mutex> guard(this->lock);
+
+			if(!(this->threadConfigErrors.empty()))
+				this->threadConfigErrors += "; ";
+
+			this->threadConfigErrors += "worker #" + std::to_string(band) + ": " + errors;
+		}
+	}
+
+	while(true) {
+		{
+			std::unique_lock<std::mutex> guard(this->lock);
+
+			this->wakeUp.wait(guard, [this, lastGeneration] {
+				return !(this->running) || this->generation != lastGeneration;
+			});
+
+			if(!(this->running))
+				return;
+
+			lastGeneration = this->generation;
+
+			// skip empty jobs (nothing to be processed or waited for)
+			if(!(this->currentJob) || !(*(this->currentJob)))
+				continue;
+		}
+
+		this->process(band);
+
+		{
+			std::lock_guard<std::mutex> guard(this->lock);
+
+			--(this->pending);
+		}
+
+		this->finished.notify_one();
+	}
+}
+
+// process the band with the specified index of the current job
+void WorkerPool::process(unsigned int band) {
+	const std::size_t bands = this->getBands();
+	const std::size_t begin = this->currentSize * band / bands;
+	const std::size_t end = this->currentSize * (band + 1) / bands;
+
+	if(begin == end)
+		return;
+
+	try {
+		(*(this->currentJob))(begin, end, band);
+	}
+	catch(...) {
+		std::lock_guard<std::mutex> guard(this->lock);
+
+		if(!(this->lastException))
+			this->lastException = std::current_exception();
+	}
+}
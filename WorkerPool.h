@@ -0,0 +1,70 @@
+/*
+ * WorkerPool.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: ans
+ */
+
+#ifndef WORKERPOOL_H_
+#define WORKERPOOL_H_
+
+#pragma once
+
+#include <condition_variable>	// std::condition_variable
+#include <cstddef>				// std::size_t
+#include <exception>			// std::exception_ptr, std::current_exception, std::rethrow_exception
+#include <functional>			// std::function
+#include <mutex>				// std::lock_guard, std::mutex, std::unique_lock
+#include <string>				// std::string
+#include <thread>				// std::thread
+#include <vector>				// std::vector
+
+#include "ThreadConfig.h"
+
+// a pool of persistent worker threads for splitting work into bands (e.g. rows of pixels)
+//	NOTE:	The calling thread will process the first band itself.
+//			Not thread-safe, i.e. only one thread should use the pool at a time.
+class WorkerPool {
+public:
+	// function processing the elements from begin to end (exclusive) as the band with the specified index
+	using Job = std::function<void(std::size_t begin, std::size_t end, unsigned int band)>;
+
+	WorkerPool();
+	virtual ~WorkerPool();
+
+	void start(unsigned int workers);
+	void stop();
+
+	void setThreadConfig(const ThreadConfig& config);
+	bool isThreadConfigErrorsOccured(std::string& errorsOut);
+
+	unsigned int getBands() const;
+
+	void run(std::size_t n, const Job& job);
+
+	WorkerPool(const WorkerPool&) = delete;
+	WorkerPool& operator=(const WorkerPool&) = delete;
+
+private:
+	void thread(unsigned int band, unsigned long lastGeneration);
+	void process(unsigned int band);
+
+	std::vector<std::thread> threads;
+	std::mutex lock;
+	std::condition_variable wakeUp;
+	std::condition_variable finished;
+
+	const Job * currentJob;
+	std::size_t currentSize;
+	unsigned long generation;
+	unsigned int pending;
+	bool running;
+
+	std::exception_ptr lastException;
+
+	ThreadConfig threadConfig;
+	bool isThreadConfigSet;
+	std::string threadConfigErrors;
+};
+
+#endif /* WORKERPOOL_H_ */
@@ -5,10 +5,14 @@
  *      Author: ans
  */
 
+#include "Benchmark.h"
 #include "Example.h"
+#include "ExampleFractal.h"
 #include "ExampleNoise.h"
 #include "ExampleRects.h"
 #include "ExampleSound.h"
+#include "ExampleStatic.h"
+#include "RandTest.h"
 
 int main(int argc, char * argv[]) {
 	/*
@@ -23,6 +27,8 @@ int main(int argc, char * argv[]) {
 	 * EXAMPLE 1: Draw every pixel with a random color changing each frame.
 	 *
 	 * Press SPACE to change the algorithm for creating pseudo-random numbers.
+	 * Press H to switch to hashed noise, computed for every pixel independently.
+	 * Press I to change the interlacing (none, rows, checkerboard) and R to change the reconstruction of missing pixels.
 	 * Press the UP and DOWN arrow keys to adjust the 'pixel' size.
 	 * Press the F10-F12 keys to change the rendering mode.
 	 */
@@ -52,6 +58,42 @@ int main(int argc, char * argv[]) {
 	 * Press the RIGHT and LEFT arrow keys to adjust the resolution of the rendered sound wave.
 	 * Press the UP and DOWN arrow keys to adjust the 'pixel' size.
 	 * Press the F10-F12 keys to change the rendering mode (F10=Pixel Buffer, F11=OpenGL Points, F12=Texture).
+	 *
+	 * Specify a path as first argument to export metrics in the Prometheus text format every second
+	 * (prefix the path with 'unix:' to serve them via a Unix domain socket instead of writing them into a file).
 	 */
 	//return ExampleSound().run(argc, argv);
+
+	/*
+	 * EXAMPLE 4: Draw the Mandelbrot set progressively over multiple frames.
+	 *
+	 * Press SPACE to switch between progressive and immediate rendering.
+	 * Press the W, A, S and D keys to move around.
+	 * Press PAGE UP and PAGE DOWN to zoom in and out.
+	 * Press the UP and DOWN arrow keys to adjust the 'pixel' size.
+	 * Press the F10-F12 keys to change the rendering mode (F10=Pixel Buffer, F11=OpenGL Points, F12=Texture).
+	 */
+	//return ExampleFractal().run(argc, argv);
+
+	/*
+	 * EXAMPLE 5: Draw a moving pattern with an engine resolved at compile time (see StaticEngine).
+	 *
+	 * Press SPACE to pause the animation.
+	 */
+	//return ExampleStatic().run(argc, argv);
+
+	/*
+	 * BENCHMARK: Measure the hot primitives and write the results into a JSON file.
+	 *
+	 * Specify the name of the JSON file as first argument (default: benchmark.json).
+	 * Drawing into the window will be measured in every rendering mode, the window will be closed afterwards.
+	 */
+	//return Benchmark().run(argc, argv);
+
+	/*
+	 * RAND TEST: Test the quality and measure the throughput of every algorithm for creating pseudo-random numbers.
+	 *
+	 * Specify the name of the Markdown file for the resulting table as first argument (default: randtest.md).
+	 */
+	//return RandTest().run(argc, argv);
 }